@@ -5,13 +5,738 @@
 
 #define DT_DRV_COMPAT microcrystal_rv8803_catie
 
+#include <string.h>
 #include <zephyr/logging/log.h>
 
 #include "rv8803.h"
 
 LOG_MODULE_REGISTER(RV8803, CONFIG_RTC_LOG_LEVEL);
 
+#if CONFIG_RV8803_BUS_STATS && CONFIG_STATS
+STATS_NAME_START(rv8803_bus)
+STATS_NAME(rv8803_bus, transfers)
+STATS_NAME(rv8803_bus, bytes_read)
+STATS_NAME(rv8803_bus, bytes_written)
+STATS_NAME(rv8803_bus, errors)
+STATS_NAME(rv8803_bus, bus_time_us)
+STATS_NAME_END(rv8803_bus);
+#endif /* CONFIG_RV8803_BUS_STATS && CONFIG_STATS */
+
+/* I2C transfers, accounted to the current bus caller */
+static void rv8803_i2c_account(const struct device *dev, uint32_t cycles, uint32_t read,
+			       uint32_t written, int err)
+{
+#if CONFIG_RV8803_BUS_STATS
+	struct rv8803_data *data = dev->data;
+	struct rv8803_bus_stats *stats = &data->shadow->stats[data->shadow->caller];
+	uint64_t ns = k_cyc_to_ns_floor64(k_cycle_get_32() - cycles);
+
+	stats->transfers++;
+	stats->bytes_read += read;
+	stats->bytes_written += written;
+	stats->errors += (err < 0) ? 1 : 0;
+	stats->bus_time_ns += ns;
+
+#if CONFIG_STATS
+	STATS_INC(data->shadow->stats_group, transfers);
+	STATS_INCN(data->shadow->stats_group, bytes_read, read);
+	STATS_INCN(data->shadow->stats_group, bytes_written, written);
+	if (err < 0) {
+		STATS_INC(data->shadow->stats_group, errors);
+	}
+	STATS_INCN(data->shadow->stats_group, bus_time_us, ns / NSEC_PER_USEC);
+#endif /* CONFIG_STATS */
+#else
+	ARG_UNUSED(dev);
+	ARG_UNUSED(cycles);
+	ARG_UNUSED(read);
+	ARG_UNUSED(written);
+	ARG_UNUSED(err);
+#endif /* CONFIG_RV8803_BUS_STATS */
+}
+
+static int rv8803_i2c_read(const struct device *dev, uint8_t start, uint8_t *buf, uint32_t num)
+{
+	const struct rv8803_config *config = dev->config;
+	uint32_t cycles = k_cycle_get_32();
+	int err;
+
+	err = i2c_burst_read_dt(&config->i2c_bus, start, buf, num);
+	rv8803_i2c_account(dev, cycles, num, 0, err);
+
+	return err;
+}
+
+static int rv8803_i2c_write(const struct device *dev, uint8_t start, const uint8_t *buf,
+			    uint32_t num)
+{
+	const struct rv8803_config *config = dev->config;
+	uint32_t cycles = k_cycle_get_32();
+	int err;
+
+	err = i2c_burst_write_dt(&config->i2c_bus, start, buf, num);
+	rv8803_i2c_account(dev, cycles, 0, num, err);
+
+	return err;
+}
+
+/* Shadow registers */
+static bool rv8803_shadow_has(uint8_t reg)
+{
+	/* FLAG is set by the device itself and can not be cached */
+	return (reg >= RV8803_SHADOW_FIRST) && (reg <= RV8803_SHADOW_LAST) &&
+	       (reg != RV8803_REGISTER_FLAG);
+}
+
+static void rv8803_shadow_store(struct rv8803_data *data, uint8_t start, const uint8_t *buf,
+				uint32_t num)
+{
+	for (uint32_t i = 0; i < num; i++) {
+		if (rv8803_shadow_has(start + i)) {
+			data->shadow->regs[start + i - RV8803_SHADOW_FIRST] = buf[i];
+		}
+	}
+}
+
+static int rv8803_shadow_load(const struct device *dev, uint8_t *flag)
+{
+	struct rv8803_data *data = dev->data;
+	uint8_t regs[RV8803_SHADOW_SIZE];
+	int err;
+
+	err = rv8803_i2c_read(dev, RV8803_SHADOW_FIRST, regs, sizeof(regs));
+	if (err < 0) {
+		return err;
+	}
+
+	rv8803_shadow_store(data, RV8803_SHADOW_FIRST, regs, sizeof(regs));
+	*flag = regs[RV8803_REGISTER_FLAG - RV8803_SHADOW_FIRST];
+
+	return 0;
+}
+
+#if CONFIG_RV8803_BUS_STATS
+int rv8803_bus_stats_get(const struct device *dev, enum rv8803_bus_caller caller,
+			 struct rv8803_bus_stats *stats)
+{
+	struct rv8803_data *data = dev->data;
+
+	if ((caller >= RV8803_BUS_CALLER_COUNT) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&data->shadow->lock, K_FOREVER);
+	*stats = data->shadow->stats[caller];
+	k_mutex_unlock(&data->shadow->lock);
+
+	return 0;
+}
+
+void rv8803_bus_stats_reset(const struct device *dev)
+{
+	struct rv8803_data *data = dev->data;
+
+	k_mutex_lock(&data->shadow->lock, K_FOREVER);
+	memset(data->shadow->stats, 0, sizeof(data->shadow->stats));
+	k_mutex_unlock(&data->shadow->lock);
+}
+#endif /* CONFIG_RV8803_BUS_STATS */
+
+#if CONFIG_RV8803_DETECT_BATTERY_STATE
+static int rv8803_battery_check(const struct device *dev, uint8_t flag)
+{
+	struct rv8803_data *data = dev->data;
+	int err = 0;
+
+	LOG_DBG("FLAG REGISTER: [0x%02X]",
+		flag & (RV8803_FLAG_MASK_LOW_VOLTAGE_1 | RV8803_FLAG_MASK_LOW_VOLTAGE_2));
+	data->bat->power_on_reset = (flag & RV8803_FLAG_MASK_LOW_VOLTAGE_2) >> 1;
+	data->bat->low_battery = flag & RV8803_FLAG_MASK_LOW_VOLTAGE_1;
+
+	if (data->bat->power_on_reset) {
+		LOG_WRN("POR was true on last reset! Battery may need replacement!");
+		if (data->bat->low_battery) {
+			LOG_WRN("LOW is also true, it will be cleared as well.");
+		}
+		err = rv8803_bus_flag_clear(dev, RV8803_FLAG_MASK_LOW_VOLTAGE_2);
+	} else if (data->bat->low_battery) {
+		LOG_WRN("LOW was true on last reset! Battery may need replacement!");
+		err = rv8803_bus_flag_clear(dev, RV8803_FLAG_MASK_LOW_VOLTAGE_1);
+	}
+	if (err < 0) {
+		LOG_ERR("Failed to write FLAGS register!!");
+	}
+
+	return err;
+}
+#endif /* CONFIG_RV8803_DETECT_BATTERY_STATE */
+
+/* First bus access: wait for the end of the start-up window, then load the shadow registers */
+static int rv8803_startup(const struct device *dev)
+{
+	struct rv8803_data *data = dev->data;
+	enum rv8803_bus_caller caller;
+	int64_t remaining;
+	uint8_t flag;
+	int err;
+	int ret;
+
+	if (data->shadow->loaded) {
+		return 0;
+	}
+
+	/* Accounted to start-up rather than to the API which happens to come first */
+	caller = data->shadow->caller;
+	data->shadow->caller = RV8803_BUS_CALLER_STARTUP;
+
+	remaining = data->shadow->ready_at - k_uptime_get();
+	if (remaining > 0) {
+		k_sleep(K_MSEC(remaining));
+	}
+
+	err = rv8803_shadow_load(dev, &flag);
+	if (err < 0) {
+		LOG_ERR("Failed to read control registers!!");
+		goto restore;
+	}
+	data->shadow->loaded = true;
+	data->shadow->power_lost = flag & RV8803_FLAG_MASK_LOW_VOLTAGE_2;
+
+#if CONFIG_RTC_CALIBRATION
+	if (data->shadow->power_lost && data->shadow->offset_restore) {
+		err = rv8803_i2c_write(dev, RV8803_REGISTER_OFFSET, &data->shadow->offset, 1);
+		if (err < 0) {
+			LOG_ERR("Failed to restore OFFSET register!!");
+		}
+	}
+#endif /* CONFIG_RTC_CALIBRATION */
+
+	/* V2F handled once: the next boots skip the start-up window and the OFFSET restore */
+#if CONFIG_RV8803_DETECT_BATTERY_STATE
+	ret = rv8803_battery_check(dev, flag);
+#else
+	ret = 0;
+	if (flag & RV8803_FLAG_MASK_LOW_VOLTAGE_2) {
+		ret = rv8803_bus_flag_clear(dev, RV8803_FLAG_MASK_LOW_VOLTAGE_2);
+		if (ret < 0) {
+			LOG_ERR("Failed to write FLAGS register!!");
+		}
+	}
+#endif /* CONFIG_RV8803_DETECT_BATTERY_STATE */
+
+	/* The first error is reported */
+	if (err == 0) {
+		err = ret;
+	}
+
+restore:
+	data->shadow->caller = caller;
+
+	return err;
+}
+
+/* Bus access */
+static int rv8803_bus_acquire(const struct device *dev)
+{
+	struct rv8803_data *data = dev->data;
+	int err;
+
+	k_mutex_lock(&data->shadow->lock, K_FOREVER);
+	err = rv8803_startup(dev);
+	if (err < 0) {
+		k_mutex_unlock(&data->shadow->lock);
+	}
+
+	return err;
+}
+
+static void rv8803_bus_release(const struct device *dev)
+{
+	struct rv8803_data *data = dev->data;
+
+	k_mutex_unlock(&data->shadow->lock);
+}
+
+enum rv8803_bus_caller rv8803_bus_lock(const struct device *dev, enum rv8803_bus_caller caller)
+{
+	struct rv8803_data *data = dev->data;
+	enum rv8803_bus_caller previous;
+
+	k_mutex_lock(&data->shadow->lock, K_FOREVER);
+	previous = data->shadow->caller;
+	data->shadow->caller = caller;
+
+	return previous;
+}
+
+void rv8803_bus_unlock(const struct device *dev, enum rv8803_bus_caller previous)
+{
+	struct rv8803_data *data = dev->data;
+
+	data->shadow->caller = previous;
+	k_mutex_unlock(&data->shadow->lock);
+}
+
+int rv8803_bus_burst_read(const struct device *dev, uint8_t start, uint8_t *buf, uint32_t num)
+{
+	struct rv8803_data *data = dev->data;
+	bool cached = true;
+	int err;
+
+	for (uint32_t i = 0; i < num; i++) {
+		cached = cached && rv8803_shadow_has(start + i);
+	}
+
+	err = rv8803_bus_acquire(dev);
+	if (err < 0) {
+		return err;
+	}
+
+	if (cached) {
+		memcpy(buf, &data->shadow->regs[start - RV8803_SHADOW_FIRST], num);
+		rv8803_bus_release(dev);
+		return 0;
+	}
+
+	err = rv8803_i2c_read(dev, start, buf, num);
+	if (err == 0) {
+		rv8803_shadow_store(data, start, buf, num);
+	}
+	rv8803_bus_release(dev);
+
+	return err;
+}
+
+int rv8803_bus_reg_read(const struct device *dev, uint8_t reg, uint8_t *value)
+{
+	return rv8803_bus_burst_read(dev, reg, value, 1);
+}
+
+int rv8803_bus_burst_write(const struct device *dev, uint8_t start, const uint8_t *buf,
+			   uint32_t num)
+{
+	struct rv8803_data *data = dev->data;
+	int err;
+
+	err = rv8803_bus_acquire(dev);
+	if (err < 0) {
+		return err;
+	}
+
+	err = rv8803_i2c_write(dev, start, buf, num);
+	if (err == 0) {
+		rv8803_shadow_store(data, start, buf, num);
+	}
+	rv8803_bus_release(dev);
+
+	return err;
+}
+
+int rv8803_bus_reg_write(const struct device *dev, uint8_t reg, uint8_t value)
+{
+	return rv8803_bus_burst_write(dev, reg, &value, 1);
+}
+
+int rv8803_bus_reg_update(const struct device *dev, uint8_t reg, uint8_t mask, uint8_t value)
+{
+	struct rv8803_data *data = dev->data;
+	uint8_t old_value;
+	uint8_t new_value;
+	int err;
+
+	err = rv8803_bus_acquire(dev);
+	if (err < 0) {
+		return err;
+	}
+
+	/* Read side served from RAM when cached, skip the write when nothing changes */
+	if (rv8803_shadow_has(reg)) {
+		old_value = data->shadow->regs[reg - RV8803_SHADOW_FIRST];
+	} else {
+		err = rv8803_i2c_read(dev, reg, &old_value, 1);
+		if (err < 0) {
+			goto release;
+		}
+	}
+
+	new_value = (old_value & ~mask) | (value & mask);
+	if (new_value != old_value) {
+		err = rv8803_bus_reg_write(dev, reg, new_value);
+	}
+
+release:
+	rv8803_bus_release(dev);
+
+	return err;
+}
+
+int rv8803_bus_flag_clear(const struct device *dev, uint8_t mask)
+{
+	/* FLAG bits are cleared by writing 0, writing 1 leaves them untouched */
+	return rv8803_bus_reg_write(dev, RV8803_REGISTER_FLAG, (uint8_t)~mask);
+}
+
+#if CONFIG_RTC_CALIBRATION
+int rv8803_offset_restore(const struct device *dev, uint8_t offset)
+{
+	struct rv8803_data *data = dev->data;
+	enum rv8803_bus_caller caller;
+	int err = 0;
+
+	caller = rv8803_bus_lock(dev, RV8803_BUS_CALLER_STARTUP);
+	data->shadow->offset = offset;
+	data->shadow->offset_restore = true;
+	if (data->shadow->loaded && data->shadow->power_lost) {
+		err = rv8803_bus_reg_write(dev, RV8803_REGISTER_OFFSET, offset);
+	}
+	rv8803_bus_unlock(dev, caller);
+
+	return err;
+}
+#endif /* CONFIG_RTC_CALIBRATION */
+
+/* Write plan */
+void rv8803_bus_plan_init(struct rv8803_bus_plan *plan)
+{
+	memset(plan, 0, sizeof(*plan));
+}
+
+void rv8803_bus_plan_write(struct rv8803_bus_plan *plan, uint8_t start, const uint8_t *buf,
+			   uint32_t num)
+{
+	struct i2c_msg *msg = NULL;
+	bool merge = false;
+
+	if ((num == 0) || (plan->err < 0)) {
+		return;
+	}
+
+	/* Merge when the burst ends right before start */
+	if (plan->count > 0) {
+		msg = &plan->msgs[plan->count - 1];
+		merge = (msg->buf[0] + msg->len - 1 == start);
+	}
+
+	if ((plan->used + num + (merge ? 0 : 1) > sizeof(plan->buf)) ||
+	    (!merge && (plan->count == RV8803_BUS_PLAN_BURSTS))) {
+		plan->err = -ENOMEM;
+		return;
+	}
+
+	/* A new burst starts with the register address */
+	if (!merge) {
+		msg = &plan->msgs[plan->count++];
+		msg->buf = &plan->buf[plan->used++];
+		msg->buf[0] = start;
+		msg->len = 1;
+		msg->flags = I2C_MSG_WRITE | ((plan->count > 1) ? I2C_MSG_RESTART : 0);
+	}
+
+	memcpy(&plan->buf[plan->used], buf, num);
+	plan->used += num;
+	msg->len += num;
+}
+
+int rv8803_bus_plan_update(const struct device *dev, struct rv8803_bus_plan *plan, uint8_t reg,
+			   uint8_t mask, uint8_t value)
+{
+	struct rv8803_data *data = dev->data;
+	uint8_t old_value;
+	uint8_t new_value;
+	int err;
+
+	if (!rv8803_shadow_has(reg)) {
+		return -ENOTSUP;
+	}
+
+	err = rv8803_bus_acquire(dev);
+	if (err < 0) {
+		return err;
+	}
+	old_value = data->shadow->regs[reg - RV8803_SHADOW_FIRST];
+	rv8803_bus_release(dev);
+
+	/* The last staged write wins over the device content */
+	for (uint8_t i = 0; i < plan->count; i++) {
+		const struct i2c_msg *msg = &plan->msgs[i];
+
+		if ((reg >= msg->buf[0]) && (reg < msg->buf[0] + msg->len - 1)) {
+			old_value = msg->buf[reg - msg->buf[0] + 1];
+		}
+	}
+
+	new_value = (old_value & ~mask) | (value & mask);
+	if (new_value != old_value) {
+		rv8803_bus_plan_write(plan, reg, &new_value, 1);
+	}
+
+	return 0;
+}
+
+void rv8803_bus_plan_flag_clear(struct rv8803_bus_plan *plan, uint8_t mask)
+{
+	uint8_t value = ~mask;
+
+	rv8803_bus_plan_write(plan, RV8803_REGISTER_FLAG, &value, 1);
+}
+
+int rv8803_bus_plan_commit(const struct device *dev, struct rv8803_bus_plan *plan)
+{
+	const struct rv8803_config *config = dev->config;
+	struct rv8803_data *data = dev->data;
+	uint32_t cycles;
+	int err;
+
+	if ((plan->err < 0) || (plan->count == 0)) {
+		return plan->err;
+	}
+
+	err = rv8803_bus_acquire(dev);
+	if (err < 0) {
+		return err;
+	}
+
+	plan->msgs[plan->count - 1].flags |= I2C_MSG_STOP;
+	cycles = k_cycle_get_32();
+	err = i2c_transfer_dt(&config->i2c_bus, plan->msgs, plan->count);
+	rv8803_i2c_account(dev, cycles, 0, plan->used - plan->count, err);
+	if (err == 0) {
+		for (uint8_t i = 0; i < plan->count; i++) {
+			rv8803_shadow_store(data, plan->msgs[i].buf[0], &plan->msgs[i].buf[1],
+					    plan->msgs[i].len - 1);
+		}
+	}
+	rv8803_bus_release(dev);
+
+	return err;
+}
+
 #if RV8803_HAS_IRQ
+#if CONFIG_RV8803_WORKQUEUE_DEDICATED
+K_THREAD_STACK_DEFINE(rv8803_workq_stack, CONFIG_RV8803_WORKQUEUE_STACK_SIZE);
+static struct k_work_q rv8803_workq;
+
+/* Started before any instance, shared by all of them */
+static int rv8803_workq_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "rv8803_workq",
+	};
+
+	k_work_queue_init(&rv8803_workq);
+	k_work_queue_start(&rv8803_workq, rv8803_workq_stack,
+			   K_THREAD_STACK_SIZEOF(rv8803_workq_stack), CONFIG_RV8803_WORKQUEUE_PRIORITY,
+			   &cfg);
+
+	return 0;
+}
+
+SYS_INIT(rv8803_workq_init, POST_KERNEL, 0);
+#endif /* CONFIG_RV8803_WORKQUEUE_DEDICATED */
+
+#if CONFIG_RV8803_LATENCY_STATS
+#if CONFIG_STATS
+STATS_NAME_START(rv8803_latency)
+STATS_NAME(rv8803_latency, alarm_count)
+STATS_NAME(rv8803_latency, alarm_start_max_us)
+STATS_NAME(rv8803_latency, alarm_done_max_us)
+STATS_NAME(rv8803_latency, alarm_done_avg_us)
+STATS_NAME(rv8803_latency, update_count)
+STATS_NAME(rv8803_latency, update_start_max_us)
+STATS_NAME(rv8803_latency, update_done_max_us)
+STATS_NAME(rv8803_latency, update_done_avg_us)
+STATS_NAME(rv8803_latency, timer_count)
+STATS_NAME(rv8803_latency, timer_start_max_us)
+STATS_NAME(rv8803_latency, timer_done_max_us)
+STATS_NAME(rv8803_latency, timer_done_avg_us)
+STATS_NAME_END(rv8803_latency);
+
+static void rv8803_latency_stats_update(struct rv8803_irq *irq, enum rv8803_event_type type)
+{
+	const struct rv8803_latency *latency = &irq->latency[type];
+
+	switch (type) {
+	case RV8803_EVENT_ALARM:
+		STATS_SET(irq->stats, alarm_count, latency->count);
+		STATS_SET(irq->stats, alarm_start_max_us, latency->start.max_us);
+		STATS_SET(irq->stats, alarm_done_max_us, latency->done.max_us);
+		STATS_SET(irq->stats, alarm_done_avg_us, latency->done.avg_us);
+		break;
+
+	case RV8803_EVENT_UPDATE:
+		STATS_SET(irq->stats, update_count, latency->count);
+		STATS_SET(irq->stats, update_start_max_us, latency->start.max_us);
+		STATS_SET(irq->stats, update_done_max_us, latency->done.max_us);
+		STATS_SET(irq->stats, update_done_avg_us, latency->done.avg_us);
+		break;
+
+	case RV8803_EVENT_TIMER:
+		STATS_SET(irq->stats, timer_count, latency->count);
+		STATS_SET(irq->stats, timer_start_max_us, latency->start.max_us);
+		STATS_SET(irq->stats, timer_done_max_us, latency->done.max_us);
+		STATS_SET(irq->stats, timer_done_avg_us, latency->done.avg_us);
+		break;
+
+	default:
+		break;
+	}
+}
+#endif /* CONFIG_STATS */
+
+static void rv8803_latency_stage_add(struct rv8803_latency_stage *stage, uint32_t count,
+				     uint32_t cycles)
+{
+	uint32_t us = k_cyc_to_us_floor32(cycles);
+	int bucket = 0;
+
+	while ((bucket < (RV8803_LATENCY_BUCKETS - 1)) &&
+	       (us >= (RV8803_LATENCY_BUCKET_US << bucket))) {
+		bucket++;
+	}
+
+	stage->min_us = (count == 1) ? us : MIN(stage->min_us, us);
+	stage->max_us = MAX(stage->max_us, us);
+	stage->sum_us += us;
+	stage->avg_us = stage->sum_us / count;
+	stage->histogram[bucket]++;
+}
+
+void rv8803_latency_record(const struct device *dev, enum rv8803_event_type type,
+			   const struct rv8803_event *event)
+{
+	struct rv8803_data *data = dev->data;
+	struct rv8803_irq *irq = data->irq;
+	uint32_t now = k_cycle_get_32();
+	struct rv8803_latency *latency = &irq->latency[type];
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&irq->latency_lock);
+	latency->count++;
+	rv8803_latency_stage_add(&latency->start, latency->count,
+				 event->work_cycles - event->isr_cycles);
+	rv8803_latency_stage_add(&latency->done, latency->count, now - event->isr_cycles);
+#if CONFIG_STATS
+	rv8803_latency_stats_update(irq, type);
+#endif /* CONFIG_STATS */
+	k_spin_unlock(&irq->latency_lock, key);
+}
+
+int rv8803_latency_get(const struct device *dev, enum rv8803_event_type type,
+		       struct rv8803_latency *latency)
+{
+	struct rv8803_data *data = dev->data;
+	k_spinlock_key_t key;
+
+	if ((type >= RV8803_EVENT_TYPE_COUNT) || (latency == NULL)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&data->irq->latency_lock);
+	*latency = data->irq->latency[type];
+	k_spin_unlock(&data->irq->latency_lock, key);
+
+	return 0;
+}
+
+void rv8803_latency_reset(const struct device *dev)
+{
+	struct rv8803_data *data = dev->data;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&data->irq->latency_lock);
+	memset(data->irq->latency, 0, sizeof(data->irq->latency));
+#if CONFIG_STATS
+	for (int i = 0; i < RV8803_EVENT_TYPE_COUNT; i++) {
+		rv8803_latency_stats_update(data->irq, i);
+	}
+#endif /* CONFIG_STATS */
+	k_spin_unlock(&data->irq->latency_lock, key);
+}
+#endif /* CONFIG_RV8803_LATENCY_STATS */
+
+void rv8803_irq_register(const struct device *dev, enum rv8803_irq_slot slot, uint8_t mask,
+			 rv8803_irq_handler_t handler, const struct device *child)
+{
+	struct rv8803_data *data = dev->data;
+	struct rv8803_irq_handler *entry = &data->irq->handlers[slot];
+
+	entry->dev = child;
+	entry->handler = handler;
+	entry->mask = mask;
+}
+
+uint8_t rv8803_irq_pending_get(const struct device *dev)
+{
+	struct rv8803_data *data = dev->data;
+
+	return (uint8_t)atomic_get(&data->irq->pending);
+}
+
+void rv8803_irq_pending_clear(const struct device *dev, uint8_t mask)
+{
+	struct rv8803_data *data = dev->data;
+
+	atomic_and(&data->irq->pending, ~(atomic_val_t)mask);
+}
+
+static void rv8803_irq_worker(struct k_work *p_work)
+{
+	struct rv8803_irq *irq = CONTAINER_OF(p_work, struct rv8803_irq, work);
+	struct rv8803_event event;
+	enum rv8803_bus_caller caller;
+	uint8_t regs[RV8803_REGISTER_FLAG + 1];
+	uint8_t clear = 0;
+	int err;
+
+#if CONFIG_RV8803_LATENCY_STATS
+	uint32_t work_cycles = k_cycle_get_32();
+#endif /* CONFIG_RV8803_LATENCY_STATS */
+
+	LOG_DBG("Process IRQ worker from interrupt");
+
+	/* Calendar and FLAG in one burst: every event carries its timestamp */
+	caller = rv8803_bus_lock(irq->dev, RV8803_BUS_CALLER_IRQ);
+	err = rv8803_bus_burst_read(irq->dev, RV8803_REGISTER_SECONDS, regs, sizeof(regs));
+	rv8803_bus_unlock(irq->dev, caller);
+	if (err < 0) {
+		LOG_ERR("IRQ worker I2C read FLAGS error");
+		return;
+	}
+
+	event.uptime = irq->uptime;
+	event.isr_cycles = irq->cycles;
+#if CONFIG_RV8803_LATENCY_STATS
+	event.work_cycles = work_cycles;
+#endif /* CONFIG_RV8803_LATENCY_STATS */
+	memcpy(event.time, regs, sizeof(event.time));
+	event.flag = regs[RV8803_REGISTER_FLAG];
+
+	/* Latched before the handlers run, so they can consume it */
+	for (int i = 0; i < RV8803_IRQ_SLOT_COUNT; i++) {
+		if (irq->handlers[i].handler != NULL) {
+			atomic_or(&irq->pending, event.flag & irq->handlers[i].mask);
+		}
+	}
+
+	for (int i = 0; i < RV8803_IRQ_SLOT_COUNT; i++) {
+		const struct rv8803_irq_handler *entry = &irq->handlers[i];
+
+		if ((entry->handler != NULL) && (event.flag & entry->mask)) {
+			clear |= entry->handler(entry->dev, &event) & entry->mask;
+		}
+	}
+
+	/* Handled bits of every child cleared in a single write */
+	if (clear != 0) {
+		caller = rv8803_bus_lock(irq->dev, RV8803_BUS_CALLER_IRQ);
+		err = rv8803_bus_flag_clear(irq->dev, clear);
+		rv8803_bus_unlock(irq->dev, caller);
+		if (err < 0) {
+			LOG_ERR("IRQ worker I2C clear FLAGS error");
+		}
+	}
+}
+
 static void rv8803_gpio_callback_handler(const struct device *p_port, struct gpio_callback *p_cb,
 					 gpio_port_pins_t pins)
 {
@@ -20,16 +745,15 @@ static void rv8803_gpio_callback_handler(const struct device *p_port, struct gpi
 
 	struct rv8803_irq *data = CONTAINER_OF(p_cb, struct rv8803_irq, gpio_cb);
 
-#if defined(RV8803_IRQ_RTC_IN_USE)
-	if (data->rtc_work.handler != NULL) {
-		k_work_submit(&data->rtc_work); /* Using work queue to exit isr context */
-	}
-#endif /* RV8803_IRQ_RTC_IN_USE */
-#if defined(RV8803_IRQ_GPIO_USE_COUNTER)
-	if (data->cnt_work.handler != NULL) {
-		k_work_submit(&data->cnt_work); /* Using work queue to exit isr context */
-	}
-#endif /* RV8803_IRQ_GPIO_USE_COUNTER */
+	data->cycles = k_cycle_get_32();
+	data->uptime = k_uptime_ticks();
+
+	/* Using work queue to exit isr context */
+#if CONFIG_RV8803_WORKQUEUE_DEDICATED
+	k_work_submit_to_queue(&rv8803_workq, &data->work);
+#else
+	k_work_submit(&data->work);
+#endif /* CONFIG_RV8803_WORKQUEUE_DEDICATED */
 }
 #endif /* RV8803_HAS_IRQ */
 
@@ -43,12 +767,39 @@ static int rv8803_init(const struct device *dev)
 		return -ENODEV;
 	}
 
-	k_sleep(K_MSEC(RV8803_STARTUP_TIMING_MS));
-
-#if RV8803_HAS_IRQ || CONFIG_RV8803_DETECT_BATTERY_STATE
 	struct rv8803_data *data = dev->data;
+	uint8_t value;
 	int err;
-#endif
+
+	k_mutex_init(&data->shadow->lock);
+#if CONFIG_RV8803_BUS_STATS && CONFIG_STATS
+	err = stats_init_and_reg(STATS_HDR(data->shadow->stats_group),
+				 STATS_SIZE_INIT_PARMS(data->shadow->stats_group, STATS_SIZE_32),
+				 STATS_NAME_INIT_PARMS(rv8803_bus), config->bus_stats_name);
+	if (err < 0) {
+		LOG_WRN("Failed to register bus stats");
+	}
+#endif /* CONFIG_RV8803_BUS_STATS && CONFIG_STATS */
+
+	/* Without V2F the oscillator kept running on backup: no start-up window to wait for */
+	data->shadow->ready_at = RV8803_STARTUP_TIMING_MS;
+	data->shadow->caller = RV8803_BUS_CALLER_STARTUP;
+	if (k_uptime_get() < data->shadow->ready_at) {
+		err = rv8803_i2c_read(dev, RV8803_REGISTER_FLAG, &value, 1);
+		if ((err == 0) && !(value & RV8803_FLAG_MASK_LOW_VOLTAGE_2)) {
+			data->shadow->ready_at = 0;
+		}
+	}
+
+	if (k_uptime_get() >= data->shadow->ready_at) {
+		err = rv8803_startup(dev);
+		if (err < 0) {
+			return err;
+		}
+	} else {
+		LOG_INF("RV8803 start-up deferred to %lld ms", data->shadow->ready_at);
+	}
+	data->shadow->caller = RV8803_BUS_CALLER_OTHER;
 
 #if RV8803_HAS_IRQ
 	if (!gpio_is_ready_dt(&config->gpio->irq_gpio)) {
@@ -69,6 +820,16 @@ static int rv8803_init(const struct device *dev)
 		return err;
 	}
 
+	data->irq->dev = dev;
+	k_work_init(&data->irq->work, rv8803_irq_worker);
+#if CONFIG_RV8803_LATENCY_STATS && CONFIG_STATS
+	err = stats_init_and_reg(STATS_HDR(data->irq->stats),
+				 STATS_SIZE_INIT_PARMS(data->irq->stats, STATS_SIZE_32),
+				 STATS_NAME_INIT_PARMS(rv8803_latency), dev->name);
+	if (err < 0) {
+		LOG_WRN("Failed to register latency stats");
+	}
+#endif /* CONFIG_RV8803_LATENCY_STATS && CONFIG_STATS */
 	gpio_init_callback(&data->irq->gpio_cb, rv8803_gpio_callback_handler,
 			   BIT(config->gpio->irq_gpio.pin));
 
@@ -78,48 +839,8 @@ static int rv8803_init(const struct device *dev)
 		return err;
 	}
 
-#if defined(RV8803_IRQ_RTC_IN_USE)
-	data->irq->rtc_work.handler = NULL;
-#endif /* RV8803_IRQ_RTC_IN_USE */
-#if defined(RV8803_IRQ_GPIO_USE_COUNTER)
-	data->irq->cnt_work.handler = NULL;
-#endif /* RV8803_IRQ_GPIO_USE_COUNTER */
 #endif /* RV8803_HAS_IRQ */
 
-#if CONFIG_RV8803_DETECT_BATTERY_STATE
-	uint8_t value;
-	err = i2c_reg_read_byte_dt(&config->i2c_bus, RV8803_REGISTER_FLAG, &value);
-	if (err < 0) {
-		LOG_ERR("Failed to read FLAGS register!!");
-		return err;
-	}
-	LOG_DBG("FLAG REGISTER: [0x%02X]",
-		value & (RV8803_FLAG_MASK_LOW_VOLTAGE_1 | RV8803_FLAG_MASK_LOW_VOLTAGE_2));
-	data->bat->power_on_reset = (value & RV8803_FLAG_MASK_LOW_VOLTAGE_2) >> 1;
-	data->bat->low_battery = value & RV8803_FLAG_MASK_LOW_VOLTAGE_1;
-
-	if (data->bat->power_on_reset) {
-		LOG_WRN("POR was true on last reset! Battery may need replacement!");
-		if (data->bat->low_battery) {
-			LOG_WRN("LOW is also true, it will be cleared as well.");
-		}
-		value &= ~RV8803_FLAG_MASK_LOW_VOLTAGE_2;
-		err = i2c_reg_write_byte_dt(&config->i2c_bus, RV8803_REGISTER_FLAG, value);
-		if (err < 0) {
-			LOG_ERR("Failed to write FLAGS register!!");
-			return err;
-		}
-	} else if (data->bat->low_battery) {
-		LOG_WRN("LOW was true on last reset! Battery may need replacement!");
-		value &= ~RV8803_FLAG_MASK_LOW_VOLTAGE_1;
-		err = i2c_reg_write_byte_dt(&config->i2c_bus, RV8803_REGISTER_FLAG, value);
-		if (err < 0) {
-			LOG_ERR("Failed to write FLAGS register!!");
-			return err;
-		}
-	}
-#endif /* CONFIG_RV8803_DETECT_BATTERY_STATE */
-
 	LOG_INF("RV8803 INIT");
 
 	return 0;
@@ -132,13 +853,17 @@ static int rv8803_init(const struct device *dev)
 	static const struct rv8803_config rv8803_config_##n = {                                    \
 		.i2c_bus = I2C_DT_SPEC_INST_GET(n),                                                \
 		.gpio = &rv8803_config_irq_##n,                                                    \
+		IF_ENABLED(CONFIG_RV8803_BUS_STATS, (.bus_stats_name = "rv8803_bus_" #n, ))        \
 	};                                                                                         \
 	IF_ENABLED(CONFIG_RV8803_DETECT_BATTERY_STATE,                                             \
 		   (static struct rv8803_battery rv8803_battery_##n;))                             \
 	IF_ENABLED(RV8803_HAS_IRQ, (static struct rv8803_irq rv8803_irq_##n;))                     \
+	static struct rv8803_shadow rv8803_shadow_##n;                                             \
 	static struct rv8803_data rv8803_data_##n = {                                              \
 		IF_ENABLED(CONFIG_RV8803_DETECT_BATTERY_STATE, (.bat = &rv8803_battery_##n, ))     \
-			IF_ENABLED(RV8803_HAS_IRQ, (.irq = &rv8803_irq_##n, ))};                   \
+			IF_ENABLED(RV8803_HAS_IRQ, (.irq = &rv8803_irq_##n, ))                     \
+				.shadow = &rv8803_shadow_##n,                                      \
+	};                                                                                         \
 	DEVICE_DT_INST_DEFINE(n, rv8803_init, NULL, &rv8803_data_##n, &rv8803_config_##n,          \
 			      POST_KERNEL, CONFIG_RTC_INIT_PRIORITY, NULL);
 
@@ -8,6 +8,9 @@
 
 #include <zephyr/drivers/i2c.h>
 #include <zephyr/drivers/gpio.h>
+#if (CONFIG_RV8803_LATENCY_STATS || CONFIG_RV8803_BUS_STATS) && CONFIG_STATS
+#include <zephyr/stats/stats.h>
+#endif /* (CONFIG_RV8803_LATENCY_STATS || CONFIG_RV8803_BUS_STATS) && CONFIG_STATS */
 
 /* Calendar Registers */
 #define RV8803_REGISTER_SECONDS 0x00
@@ -28,11 +31,19 @@
 #define RV8803_REGISTER_FLAG      0x0E
 #define RV8803_REGISTER_CONTROL   0x0F
 
+/* Frequency offset (aging correction) register, reset to 0 on power loss */
+#define RV8803_REGISTER_OFFSET 0x2C
+
 /* Low Voltage Flag */
 #define RV8803_FLAG_MASK_LOW_VOLTAGE_1 (0x01 << 0)
 #define RV8803_FLAG_MASK_LOW_VOLTAGE_2 (0x01 << 1)
 
-/* Timing constraint */
+/* Shadow registers: writable control window cached in RAM (FLAG excluded) */
+#define RV8803_SHADOW_FIRST RV8803_REGISTER_ALARM_MINUTES
+#define RV8803_SHADOW_LAST  RV8803_REGISTER_CONTROL
+#define RV8803_SHADOW_SIZE  (RV8803_SHADOW_LAST - RV8803_SHADOW_FIRST + 1)
+
+/* Oscillator start-up window after power-on, counted from boot */
 #define RV8803_STARTUP_TIMING_MS 80
 
 /* DEFINITION of PROPERTY PARENT cf. include/zephyr/devicetree.h */
@@ -63,6 +74,9 @@
 #if defined(CONFIG_RTC_UPDATE)
 #define RV8803_IRQ_GPIO_USE_UPDATE 1
 #endif /* CONFIG_RTC_UPDATE */
+#if defined(CONFIG_RV8803_RTC_EVI)
+#define RV8803_IRQ_GPIO_USE_EVI 1
+#endif /* CONFIG_RV8803_RTC_EVI */
 #endif /* CONFIG_RV8803_RTC_ENABLE */
 #if CONFIG_RV8803_COUNTER_ENABLE
 #if defined(CONFIG_COUNTER)
@@ -71,7 +85,8 @@
 #endif /* RV8803_COUNTER_ENABLE */
 #endif /* RV8803_HAS_IRQ */
 
-#if defined(RV8803_IRQ_GPIO_USE_ALARM) || defined(RV8803_IRQ_GPIO_USE_UPDATE)
+#if defined(RV8803_IRQ_GPIO_USE_ALARM) || defined(RV8803_IRQ_GPIO_USE_UPDATE) ||                  \
+	defined(RV8803_IRQ_GPIO_USE_EVI)
 #define RV8803_IRQ_RTC_IN_USE 1
 #endif
 #if defined(RV8803_IRQ_GPIO_USE_COUNTER)
@@ -92,6 +107,9 @@ struct rv8803_config_irq {
 struct rv8803_config {
 	struct i2c_dt_spec i2c_bus;
 	struct rv8803_config_irq *gpio;
+#if CONFIG_RV8803_BUS_STATS
+	const char *bus_stats_name;
+#endif /* CONFIG_RV8803_BUS_STATS */
 };
 
 struct rv8803_battery {
@@ -101,24 +119,226 @@ struct rv8803_battery {
 #endif /* CONFIG_RV8803_DETECT_BATTERY_STATE */
 };
 
+/* Interrupt event, FLAG and calendar are read in a single burst */
+struct rv8803_event {
+	int64_t uptime;  /* Kernel ticks at the last GPIO edge */
+	uint8_t time[7]; /* Raw calendar registers 0x00 - 0x06 */
+	uint8_t flag;
+	uint32_t isr_cycles; /* Cycle count at the last GPIO edge */
+#if CONFIG_RV8803_LATENCY_STATS
+	uint32_t work_cycles; /* Cycle count at dispatcher start */
+#endif /* CONFIG_RV8803_LATENCY_STATS */
+};
+
+enum rv8803_event_type {
+	RV8803_EVENT_ALARM,
+	RV8803_EVENT_UPDATE,
+	RV8803_EVENT_TIMER,
+	RV8803_EVENT_TYPE_COUNT,
+};
+
+/* Bucket i counts latencies below (RV8803_LATENCY_BUCKET_US << i), the last one all above */
+#define RV8803_LATENCY_BUCKET_US 64
+#define RV8803_LATENCY_BUCKETS   8
+
+struct rv8803_latency_stage {
+	uint32_t min_us;
+	uint32_t max_us;
+	uint32_t avg_us;
+	uint64_t sum_us;
+	uint32_t histogram[RV8803_LATENCY_BUCKETS];
+};
+
+/* Latencies from the GPIO edge, per event type */
+struct rv8803_latency {
+	uint32_t count;
+	struct rv8803_latency_stage start; /* Dispatcher start */
+	struct rv8803_latency_stage done;  /* User callback return */
+};
+
+#if CONFIG_RV8803_LATENCY_STATS && CONFIG_STATS
+STATS_SECT_START(rv8803_latency)
+STATS_SECT_ENTRY32(alarm_count)
+STATS_SECT_ENTRY32(alarm_start_max_us)
+STATS_SECT_ENTRY32(alarm_done_max_us)
+STATS_SECT_ENTRY32(alarm_done_avg_us)
+STATS_SECT_ENTRY32(update_count)
+STATS_SECT_ENTRY32(update_start_max_us)
+STATS_SECT_ENTRY32(update_done_max_us)
+STATS_SECT_ENTRY32(update_done_avg_us)
+STATS_SECT_ENTRY32(timer_count)
+STATS_SECT_ENTRY32(timer_start_max_us)
+STATS_SECT_ENTRY32(timer_done_max_us)
+STATS_SECT_ENTRY32(timer_done_avg_us)
+STATS_SECT_END;
+#endif /* CONFIG_RV8803_LATENCY_STATS && CONFIG_STATS */
+
+/* Returns the FLAG bits to clear */
+typedef uint8_t (*rv8803_irq_handler_t)(const struct device *dev,
+					const struct rv8803_event *event);
+
+enum rv8803_irq_slot {
+	RV8803_IRQ_SLOT_RTC,
+	RV8803_IRQ_SLOT_CNT,
+	RV8803_IRQ_SLOT_COUNT,
+};
+
+struct rv8803_irq_handler {
+	const struct device *dev; /* Child device */
+	rv8803_irq_handler_t handler;
+	uint8_t mask; /* FLAG bits of interest */
+};
+
 struct rv8803_irq {
 #if RV8803_HAS_IRQ
+	const struct device *dev; /* Base device */
 	struct gpio_callback gpio_cb;
-#if RV8803_IRQ_RTC_IN_USE
-	const struct device *rtc_dev;
-	struct k_work rtc_work;
-#endif /* RV8803_IRQ_RTC_IN_USE */
-#if RV8803_IRQ_CNT_IN_USE
-	const struct device *cnt_dev;
-	struct k_work cnt_work;
-#endif /* RV8803_IRQ_CNT_IN_USE */
+	struct k_work work;
+	int64_t uptime;
+	uint32_t cycles;
+	atomic_t pending; /* FLAG bits seen by the dispatcher, until cleared by a child */
+	struct rv8803_irq_handler handlers[RV8803_IRQ_SLOT_COUNT];
+#if CONFIG_RV8803_LATENCY_STATS
+	struct k_spinlock latency_lock;
+	struct rv8803_latency latency[RV8803_EVENT_TYPE_COUNT];
+#if CONFIG_STATS
+	STATS_SECT_DECL(rv8803_latency) stats;
+#endif /* CONFIG_STATS */
+#endif /* CONFIG_RV8803_LATENCY_STATS */
 #endif /* RV8803_HAS_IRQ */
 };
 
+/* Bus users, for transaction accounting */
+enum rv8803_bus_caller {
+	RV8803_BUS_CALLER_OTHER,
+	RV8803_BUS_CALLER_STARTUP,
+	RV8803_BUS_CALLER_SET_TIME,
+	RV8803_BUS_CALLER_GET_TIME,
+	RV8803_BUS_CALLER_ALARM,
+	RV8803_BUS_CALLER_UPDATE,
+	RV8803_BUS_CALLER_COUNTER,
+	RV8803_BUS_CALLER_CLK,
+	RV8803_BUS_CALLER_RAM,
+	RV8803_BUS_CALLER_IRQ,
+	RV8803_BUS_CALLER_COUNT,
+};
+
+struct rv8803_bus_stats {
+	uint32_t transfers;
+	uint32_t bytes_read;    /* Payload, register address excluded */
+	uint32_t bytes_written; /* Payload, register address excluded */
+	uint32_t errors;
+	uint64_t bus_time_ns; /* Cumulative time spent in the I2C driver */
+};
+
+#if CONFIG_RV8803_BUS_STATS && CONFIG_STATS
+STATS_SECT_START(rv8803_bus)
+STATS_SECT_ENTRY32(transfers)
+STATS_SECT_ENTRY32(bytes_read)
+STATS_SECT_ENTRY32(bytes_written)
+STATS_SECT_ENTRY32(errors)
+STATS_SECT_ENTRY32(bus_time_us)
+STATS_SECT_END;
+#endif /* CONFIG_RV8803_BUS_STATS && CONFIG_STATS */
+
+struct rv8803_shadow {
+	struct k_mutex lock;
+	enum rv8803_bus_caller caller;
+#if CONFIG_RV8803_BUS_STATS
+	struct rv8803_bus_stats stats[RV8803_BUS_CALLER_COUNT];
+#if CONFIG_STATS
+	STATS_SECT_DECL(rv8803_bus) stats_group; /* Totals */
+#endif /* CONFIG_STATS */
+#endif /* CONFIG_RV8803_BUS_STATS */
+	int64_t ready_at; /* Uptime (ms) of the first allowed bus access */
+	bool loaded;
+	bool power_lost; /* V2F was set at start-up */
+#if CONFIG_RTC_CALIBRATION
+	bool offset_restore;
+	uint8_t offset;
+#endif /* CONFIG_RTC_CALIBRATION */
+	uint8_t regs[RV8803_SHADOW_SIZE];
+};
+
+/* Write plan: register writes staged in order, issued as one transaction */
+#define RV8803_BUS_PLAN_BURSTS 4
+#define RV8803_BUS_PLAN_SIZE   24 /* Register address and data of every burst */
+
+struct rv8803_bus_plan {
+	struct i2c_msg msgs[RV8803_BUS_PLAN_BURSTS];
+	uint8_t buf[RV8803_BUS_PLAN_SIZE];
+	uint8_t count; /* Bursts */
+	uint8_t used;  /* Bytes of buf */
+	int err;
+};
+
 /* RV8803 Base data */
 struct rv8803_data {
 	struct rv8803_battery *bat;
 	struct rv8803_irq *irq;
+	struct rv8803_shadow *shadow;
 };
 
+/* Bus access shared by children, dev is the RV8803 base device */
+/* Transfers until unlock are accounted to caller, unlock restores the returned previous one */
+enum rv8803_bus_caller rv8803_bus_lock(const struct device *dev, enum rv8803_bus_caller caller);
+void rv8803_bus_unlock(const struct device *dev, enum rv8803_bus_caller previous);
+int rv8803_bus_reg_read(const struct device *dev, uint8_t reg, uint8_t *value);
+int rv8803_bus_reg_write(const struct device *dev, uint8_t reg, uint8_t value);
+int rv8803_bus_reg_update(const struct device *dev, uint8_t reg, uint8_t mask, uint8_t value);
+int rv8803_bus_burst_read(const struct device *dev, uint8_t start, uint8_t *buf, uint32_t num);
+int rv8803_bus_burst_write(const struct device *dev, uint8_t start, const uint8_t *buf,
+			   uint32_t num);
+int rv8803_bus_flag_clear(const struct device *dev, uint8_t mask);
+
+/*
+ * A write following the previous one is merged in its burst, any other starts a new burst after a
+ * repeated start. Updates are computed from the staged value or the shadow copy (cached registers
+ * only) and skipped when nothing changes. Commit issues every burst in a single i2c_transfer.
+ */
+void rv8803_bus_plan_init(struct rv8803_bus_plan *plan);
+void rv8803_bus_plan_write(struct rv8803_bus_plan *plan, uint8_t start, const uint8_t *buf,
+			   uint32_t num);
+int rv8803_bus_plan_update(const struct device *dev, struct rv8803_bus_plan *plan, uint8_t reg,
+			   uint8_t mask, uint8_t value);
+void rv8803_bus_plan_flag_clear(struct rv8803_bus_plan *plan, uint8_t mask);
+int rv8803_bus_plan_commit(const struct device *dev, struct rv8803_bus_plan *plan);
+
+#if CONFIG_RTC_CALIBRATION
+/* Offset written back by start-up when the oscillator was found stopped, now if it already was */
+int rv8803_offset_restore(const struct device *dev, uint8_t offset);
+#endif /* CONFIG_RTC_CALIBRATION */
+
+#if CONFIG_RV8803_BUS_STATS
+int rv8803_bus_stats_get(const struct device *dev, enum rv8803_bus_caller caller,
+			 struct rv8803_bus_stats *stats);
+void rv8803_bus_stats_reset(const struct device *dev);
+#endif /* CONFIG_RV8803_BUS_STATS */
+
+#if RV8803_HAS_IRQ
+/* Interrupt dispatch, handler is called from the work queue with the child device */
+void rv8803_irq_register(const struct device *dev, enum rv8803_irq_slot slot, uint8_t mask,
+			 rv8803_irq_handler_t handler, const struct device *child);
+/* Pending state latched in RAM by the dispatcher, served without bus access */
+uint8_t rv8803_irq_pending_get(const struct device *dev);
+void rv8803_irq_pending_clear(const struct device *dev, uint8_t mask);
+#endif /* RV8803_HAS_IRQ */
+
+#if RV8803_HAS_IRQ && CONFIG_RV8803_LATENCY_STATS
+/* Called by the children once the user callback of the event returned */
+void rv8803_latency_record(const struct device *dev, enum rv8803_event_type type,
+			   const struct rv8803_event *event);
+int rv8803_latency_get(const struct device *dev, enum rv8803_event_type type,
+		       struct rv8803_latency *latency);
+void rv8803_latency_reset(const struct device *dev);
+#else
+static inline void rv8803_latency_record(const struct device *dev, enum rv8803_event_type type,
+					 const struct rv8803_event *event)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(type);
+	ARG_UNUSED(event);
+}
+#endif /* RV8803_HAS_IRQ && CONFIG_RV8803_LATENCY_STATS */
+
 #endif /* ZEPHYR_DRIVERS_RTC_RV8803_H_ */
@@ -29,18 +29,22 @@ static int rv8803_clk_set_rate(const struct device *dev, clock_control_subsys_t
 {
 	ARG_UNUSED(sys);
 	const struct rv8803_clk_config *clk_config = dev->config;
-	const struct rv8803_config *config = clk_config->base_dev->config;
+	enum rv8803_bus_caller caller;
 	uint8_t reg;
 	int err;
 
-	err = i2c_reg_read_byte_dt(&config->i2c_bus, RV8803_REGISTER_EXTENSION, &reg);
+	caller = rv8803_bus_lock(clk_config->base_dev, RV8803_BUS_CALLER_CLK);
+
+	/* Served from the shadow copy */
+	err = rv8803_bus_reg_read(clk_config->base_dev, RV8803_REGISTER_EXTENSION, &reg);
 	if (err < 0) {
-		return err;
+		goto unlock;
 	}
 
 	uintptr_t u_rate = (uintptr_t)rate;
 	if ((reg & RV8803_CLK_FREQUENCY_MASK) == (u_rate << RV8803_CLK_FREQUENCY_SHIFT)) {
-		return -EALREADY;
+		err = -EALREADY;
+		goto unlock;
 	}
 
 	reg &= ~RV8803_CLK_FREQUENCY_MASK;
@@ -61,26 +65,30 @@ static int rv8803_clk_set_rate(const struct device *dev, clock_control_subsys_t
 		break;
 
 	default:
-		return -ENOTSUP;
+		err = -ENOTSUP;
+		goto unlock;
 	}
 
-	err = i2c_reg_write_byte_dt(&config->i2c_bus, RV8803_REGISTER_EXTENSION, reg);
-	if (err < 0) {
-		return err;
-	}
+	err = rv8803_bus_reg_update(clk_config->base_dev, RV8803_REGISTER_EXTENSION,
+				    RV8803_CLK_FREQUENCY_MASK, reg);
 
-	return 0;
+unlock:
+	rv8803_bus_unlock(clk_config->base_dev, caller);
+
+	return err;
 }
 
 static int rv8803_clk_get_rate(const struct device *dev, clock_control_subsys_t sys, uint32_t *rate)
 {
 	ARG_UNUSED(sys);
 	const struct rv8803_clk_config *clk_config = dev->config;
-	const struct rv8803_config *config = clk_config->base_dev->config;
+	enum rv8803_bus_caller caller;
 	uint8_t reg;
 	int err;
 
-	err = i2c_reg_read_byte_dt(&config->i2c_bus, RV8803_REGISTER_EXTENSION, &reg);
+	caller = rv8803_bus_lock(clk_config->base_dev, RV8803_BUS_CALLER_CLK);
+	err = rv8803_bus_reg_read(clk_config->base_dev, RV8803_REGISTER_EXTENSION, &reg);
+	rv8803_bus_unlock(clk_config->base_dev, caller);
 	if (err < 0) {
 		return err;
 	}
@@ -14,139 +14,1007 @@
 LOG_MODULE_REGISTER(RV8803_CNT, CONFIG_RTC_LOG_LEVEL);
 
 #if CONFIG_COUNTER && CONFIG_RV8803_COUNTER_ENABLE
-static int rv8803_cnt_start(const struct device *dev)
+/* TD clock selection of a counter frequency */
+static int rv8803_cnt_td(uint32_t freq, uint8_t *value)
+{
+	switch (freq) {
+	case 4096:
+		*value = RV8803_COUNTER_FREQUENCY_4096_HZ;
+		break;
+
+	case 64:
+		*value = RV8803_COUNTER_FREQUENCY_64_HZ;
+		break;
+
+	case 1:
+		*value = RV8803_COUNTER_FREQUENCY_1_HZ;
+		break;
+
+	default:
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+#if CONFIG_RV8803_COUNTER_AUTO_PRESCALER
+/* TD timer clock as a fraction: 4096 Hz, 64 Hz, 1 Hz and 1/60 Hz */
+static const uint16_t rv8803_cnt_clock_num[4] = {4096, 64, 1, 1};
+static const uint8_t rv8803_cnt_clock_den[4] = {1, 1, 1, 60};
+
+/* Period in ticks of the devicetree frequency to the finest timer clock holding it in 12 bits */
+static int rv8803_cnt_prescale(uint32_t freq, uint32_t *ticks, uint8_t *value)
+{
+	for (uint8_t td = 0; td < ARRAY_SIZE(rv8803_cnt_clock_num); td++) {
+		uint64_t scaled = DIV_ROUND_CLOSEST((uint64_t)*ticks * rv8803_cnt_clock_num[td],
+						    (uint64_t)freq * rv8803_cnt_clock_den[td]);
+
+		if ((scaled > 0) && (scaled <= RV8803_COUNTER_MAX_TOP_VALUE)) {
+			*ticks = scaled;
+			*value = td;
+			return 0;
+		}
+	}
+
+	return -EINVAL;
+}
+
+void rv8803_cnt_frequency_get(const struct device *dev, uint32_t *hz, uint32_t *divider)
+{
+	const struct rv8803_cnt_data *cnt_data = dev->data;
+
+	*hz = rv8803_cnt_clock_num[cnt_data->td];
+	*divider = rv8803_cnt_clock_den[cnt_data->td];
+}
+#endif /* CONFIG_RV8803_COUNTER_AUTO_PRESCALER */
+
+#if CONFIG_RV8803_COUNTER_VIRTUAL
+/*
+ * Top periods beyond 12 bits are chained from timer periods. The preset registers are only loaded
+ * at the next reload, so the worker writes the period following the loaded one: periods end on the
+ * next boundary (top wrap or alarm) and are never shorter than the worker latency, a remaining
+ * count of at least that long being split in two periods of at least that long.
+ */
+static uint16_t rv8803_cnt_chunk(const struct rv8803_cnt_data *cnt_data, uint32_t remaining)
+{
+	if (remaining <= RV8803_COUNTER_MAX_TOP_VALUE) {
+		return remaining;
+	}
+	if (remaining < (RV8803_COUNTER_MAX_TOP_VALUE + cnt_data->min_period)) {
+		return remaining / 2;
+	}
+
+	return RV8803_COUNTER_MAX_TOP_VALUE;
+}
+
+/*
+ * Called with the lock held: ticks from position to the next top wrap or armed alarm. A wrap or an
+ * alarm closer than the minimum period (a short tail, or a short top) falls inside a longer period
+ * and is expired from the interpolated value.
+ */
+static uint32_t rv8803_cnt_boundary(const struct rv8803_cnt_data *cnt_data, uint64_t position)
+{
+	uint64_t remaining = cnt_data->top - ((position - cnt_data->period_start) % cnt_data->top);
+
+	if (remaining < cnt_data->min_period) {
+		remaining += DIV_ROUND_UP(cnt_data->min_period - remaining, cnt_data->top) *
+			     cnt_data->top;
+	}
+
+	if ((cnt_data->alarm.callback != NULL) &&
+	    (cnt_data->alarm.target >= (position + cnt_data->min_period)) &&
+	    ((cnt_data->alarm.target - position) < remaining)) {
+		remaining = cnt_data->alarm.target - position;
+	}
+
+	return MIN(remaining, UINT32_MAX);
+}
+
+/* Called with the lock held: the first preset is counted twice, before the worker can write one */
+static uint16_t rv8803_cnt_chunk_first(const struct rv8803_cnt_data *cnt_data)
+{
+	uint32_t first = rv8803_cnt_boundary(cnt_data, cnt_data->total);
+	uint32_t second = rv8803_cnt_boundary(cnt_data, cnt_data->total + first);
+
+	if ((first <= RV8803_COUNTER_MAX_TOP_VALUE) && (first <= second)) {
+		return first;
+	}
+
+	/* Both periods end before the boundary, unless it is closer than two minimum periods */
+	return CLAMP(first / 2, cnt_data->min_period, RV8803_COUNTER_MAX_TOP_VALUE);
+}
+
+/* A period out of bounds would reload before the worker writes the next one, or overflow TC */
+static int rv8803_cnt_period_check(const struct rv8803_cnt_data *cnt_data, uint16_t ticks)
+{
+	if ((ticks < cnt_data->min_period) || (ticks > RV8803_COUNTER_MAX_TOP_VALUE)) {
+		LOG_ERR("Timer period of %u ticks out of bounds", ticks);
+		return -ERANGE;
+	}
+
+	return 0;
+}
+
+/* Called with the lock held: the position in the loaded period comes from the kernel clock */
+static uint64_t rv8803_cnt_now(const struct device *dev)
 {
 	const struct rv8803_cnt_config *cnt_config = dev->config;
-	const struct rv8803_config *config = cnt_config->base_dev->config;
+	const struct rv8803_cnt_data *cnt_data = dev->data;
+	uint64_t position;
+
+	if (!cnt_data->running) {
+		return cnt_data->total;
+	}
+
+	position = (uint64_t)MAX(k_uptime_ticks() - cnt_data->edge, 0) * cnt_config->info.freq /
+		   CONFIG_SYS_CLOCK_TICKS_PER_SEC;
+
+	/* Reload not handled by the worker yet */
+	return cnt_data->total + MIN(position, cnt_data->hw_current - 1);
+}
+
+/* Called with the lock held: moves the top period to position, returns whether it wrapped */
+static bool rv8803_cnt_wrap(struct rv8803_cnt_data *cnt_data, uint64_t position)
+{
+	uint64_t elapsed = position - cnt_data->period_start;
+
+	if (elapsed < cnt_data->top) {
+		return false;
+	}
+	cnt_data->period_start += elapsed - (elapsed % cnt_data->top);
+
+	return true;
+}
+
+/* Called with the lock held: the expiry work runs at the next event inside the loaded period */
+static void rv8803_cnt_expiry_schedule(const struct device *dev)
+{
+	const struct rv8803_cnt_config *cnt_config = dev->config;
+	struct rv8803_cnt_data *cnt_data = dev->data;
+	uint64_t event = cnt_data->period_start + cnt_data->top;
+	uint64_t ahead;
+	int64_t delay;
+
+	if (cnt_data->alarm.callback != NULL) {
+		event = MIN(event, cnt_data->alarm.target);
+	}
+
+	/* Events at the end of the loaded period are expired by the reload */
+	if (!cnt_data->running || (event >= (cnt_data->total + cnt_data->hw_current))) {
+		return;
+	}
+
+	ahead = (event > cnt_data->total) ? (event - cnt_data->total) : 0;
+	delay = cnt_data->edge - k_uptime_ticks() +
+		DIV_ROUND_UP(ahead * CONFIG_SYS_CLOCK_TICKS_PER_SEC, cnt_config->info.freq);
+	k_work_reschedule(&cnt_data->expiry_work, K_TICKS(MAX(delay, 0)));
+}
+
+static void rv8803_cnt_expiry_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct rv8803_cnt_data *cnt_data = CONTAINER_OF(dwork, struct rv8803_cnt_data, expiry_work);
+	const struct device *dev = cnt_data->dev;
+	struct rv8803_cnt_alarm expired = {0};
+	bool wrapped = false;
+	k_spinlock_key_t key;
+	uint32_t value = 0;
+	uint64_t now;
+
+	key = k_spin_lock(&cnt_data->lock);
+	if (cnt_data->running) {
+		now = rv8803_cnt_now(dev);
+		wrapped = rv8803_cnt_wrap(cnt_data, now);
+		if ((cnt_data->alarm.callback != NULL) && (now >= cnt_data->alarm.target)) {
+			expired = cnt_data->alarm;
+			cnt_data->alarm.callback = NULL;
+		}
+		value = now - cnt_data->period_start;
+		rv8803_cnt_expiry_schedule(dev);
+	}
+	k_spin_unlock(&cnt_data->lock, key);
+
+	/* One-shot: the callback may arm the next alarm */
+	if (expired.callback != NULL) {
+		LOG_DBG("Calling Counter alarm callback");
+		expired.callback(dev, 0, value, expired.user_data);
+	}
+	if (wrapped && (cnt_data->counter_cb != NULL)) {
+		LOG_DBG("Calling Counter callback");
+		cnt_data->counter_cb(dev, cnt_data->user_data);
+	}
+}
+
+/* Called with the bus locked: (re)loads the timer from the current value */
+static int rv8803_cnt_virtual_load(const struct device *dev)
+{
+	const struct rv8803_cnt_config *cnt_config = dev->config;
+	struct rv8803_cnt_data *cnt_data = dev->data;
+	struct rv8803_bus_plan plan;
+	k_spinlock_key_t key;
+	uint16_t first;
+	uint8_t value;
 	int err;
 
-	err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_EXTENSION,
+	err = rv8803_cnt_td(cnt_config->info.freq, &value);
+	if (err < 0) {
+		return err;
+	}
+
+	key = k_spin_lock(&cnt_data->lock);
+	cnt_data->total = rv8803_cnt_now(dev);
+	cnt_data->running = false;
+	first = rv8803_cnt_chunk_first(cnt_data);
+	k_spin_unlock(&cnt_data->lock, key);
+
+	err = rv8803_cnt_period_check(cnt_data, first);
+	if (err < 0) {
+		return err;
+	}
+
+	rv8803_bus_plan_init(&plan);
+
+	/* TE to 0 and TD : the rising edge below loads the first period */
+	err = rv8803_bus_plan_update(cnt_config->base_dev, &plan, RV8803_REGISTER_EXTENSION,
+				     RV8803_EXTENSION_MASK_COUNTER | RV8803_FREQUENCY_MASK_COUNTER,
+				     RV8803_DISABLE_COUNTER | value);
+	if (err < 0) {
+		return err;
+	}
+
+	/* TC0/TC1, TE to 1, TF to 0 and TIE to 1 follow each other: 0x0B - 0x0F */
+	uint8_t regs[2] = {first & 0xFF, (first >> 8) & 0x0F};
+	rv8803_bus_plan_write(&plan, RV8803_REGISTER_TIMER_COUNTER_0, regs, sizeof(regs));
+	err = rv8803_bus_plan_update(cnt_config->base_dev, &plan, RV8803_REGISTER_EXTENSION,
 				     RV8803_EXTENSION_MASK_COUNTER, RV8803_ENABLE_COUNTER);
 	if (err < 0) {
 		return err;
 	}
+	rv8803_bus_plan_flag_clear(&plan, RV8803_FLAG_MASK_COUNTER);
+	err = rv8803_bus_plan_update(cnt_config->base_dev, &plan, RV8803_REGISTER_CONTROL,
+				     RV8803_CONTROL_MASK_COUNTER, RV8803_ENABLE_COUNTER);
+	if (err == 0) {
+		err = rv8803_bus_plan_commit(cnt_config->base_dev, &plan);
+	}
+	if (err < 0) {
+		return err;
+	}
+
+	key = k_spin_lock(&cnt_data->lock);
+	cnt_data->hw_current = first;
+	cnt_data->hw_next = first;
+	cnt_data->edge = k_uptime_ticks();
+	cnt_data->running = true;
+	rv8803_cnt_expiry_schedule(dev);
+	k_spin_unlock(&cnt_data->lock, key);
+
+	rv8803_irq_pending_clear(cnt_config->base_dev, RV8803_FLAG_MASK_COUNTER);
 
 	return 0;
 }
 
-static int rv8803_cnt_stop(const struct device *dev)
+/* Called with the bus locked: writes the period following the loaded one, when it changes */
+static int rv8803_cnt_virtual_preset(const struct device *dev)
 {
 	const struct rv8803_cnt_config *cnt_config = dev->config;
-	const struct rv8803_config *config = cnt_config->base_dev->config;
+	struct rv8803_cnt_data *cnt_data = dev->data;
+	k_spinlock_key_t key;
+	uint64_t reload;
+	uint16_t next;
 	int err;
 
-	err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_EXTENSION,
-				     RV8803_EXTENSION_MASK_COUNTER, RV8803_DISABLE_COUNTER);
+	key = k_spin_lock(&cnt_data->lock);
+	reload = cnt_data->total + cnt_data->hw_current;
+	next = rv8803_cnt_chunk(cnt_data, rv8803_cnt_boundary(cnt_data, reload));
+	rv8803_cnt_expiry_schedule(dev);
+	k_spin_unlock(&cnt_data->lock, key);
+
+	if (next == cnt_data->hw_next) {
+		return 0;
+	}
+	err = rv8803_cnt_period_check(cnt_data, next);
 	if (err < 0) {
 		return err;
 	}
 
+	uint8_t regs[2] = {next & 0xFF, (next >> 8) & 0x0F};
+	err = rv8803_bus_burst_write(cnt_config->base_dev, RV8803_REGISTER_TIMER_COUNTER_0, regs,
+				     sizeof(regs));
+	if (err < 0) {
+		return err;
+	}
+
+	key = k_spin_lock(&cnt_data->lock);
+	cnt_data->hw_next = next;
+	k_spin_unlock(&cnt_data->lock, key);
+
 	return 0;
 }
 
-static int rv8803_cnt_set_top_value(const struct device *dev, const struct counter_top_cfg *cfg)
+/*
+ * Called with the bus locked, on TF: the loaded period was counted and the preset started. Returns
+ * whether the top period wrapped, the expired alarm and the counter value.
+ */
+static bool rv8803_cnt_virtual_reload(const struct device *dev, const struct rv8803_event *event,
+				      struct rv8803_cnt_alarm *expired, uint32_t *value)
+{
+	struct rv8803_cnt_data *cnt_data = dev->data;
+	bool wrapped = false;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&cnt_data->lock);
+
+	/* Stopped, or TF read before the timer was reloaded */
+	if (!cnt_data->running || (event->uptime < cnt_data->edge)) {
+		k_spin_unlock(&cnt_data->lock, key);
+		return false;
+	}
+
+	cnt_data->total += cnt_data->hw_current;
+	cnt_data->hw_current = cnt_data->hw_next;
+	cnt_data->edge = event->uptime;
+	wrapped = rv8803_cnt_wrap(cnt_data, cnt_data->total);
+	if ((cnt_data->alarm.callback != NULL) && (cnt_data->total >= cnt_data->alarm.target)) {
+		*expired = cnt_data->alarm;
+		cnt_data->alarm.callback = NULL;
+	}
+	*value = cnt_data->total - cnt_data->period_start;
+	k_spin_unlock(&cnt_data->lock, key);
+
+	if (rv8803_cnt_virtual_preset(dev) < 0) {
+		LOG_ERR("Failed to write the next timer period!!");
+	}
+
+	return wrapped;
+}
+
+static int rv8803_cnt_get_value(const struct device *dev, uint32_t *ticks)
+{
+	struct rv8803_cnt_data *cnt_data = dev->data;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&cnt_data->lock);
+	*ticks = (uint32_t)(rv8803_cnt_now(dev) - cnt_data->period_start);
+	k_spin_unlock(&cnt_data->lock, key);
+
+	return 0;
+}
+
+/* Ticks counted since init, across top periods */
+static int rv8803_cnt_get_value_64(const struct device *dev, uint64_t *ticks)
+{
+	struct rv8803_cnt_data *cnt_data = dev->data;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&cnt_data->lock);
+	*ticks = rv8803_cnt_now(dev);
+	k_spin_unlock(&cnt_data->lock, key);
+
+	return 0;
+}
+
+#if CONFIG_RV8803_COUNTER_TIMERS
+static void rv8803_cnt_timer_expire(const struct device *dev, uint8_t chan_id, uint32_t ticks,
+				    void *user_data);
+#endif /* CONFIG_RV8803_COUNTER_TIMERS */
+
+/* Called with the bus locked: arms the alarm at an absolute count of ticks */
+static int rv8803_cnt_alarm_arm(const struct device *dev, uint64_t target,
+				counter_alarm_callback_t callback, void *user_data)
+{
+	struct rv8803_cnt_data *cnt_data = dev->data;
+	k_spinlock_key_t key;
+	uint64_t end;
+	bool near;
+	int err;
+
+	key = k_spin_lock(&cnt_data->lock);
+	cnt_data->alarm.callback = callback;
+	cnt_data->alarm.user_data = user_data;
+	cnt_data->alarm.target = target;
+	if (!cnt_data->running) {
+		k_spin_unlock(&cnt_data->lock, key);
+		return 0;
+	}
+	end = cnt_data->total + cnt_data->hw_current;
+
+	/* Closer than the minimum period: expired from the interpolated value, timer left as is */
+	near = target < (rv8803_cnt_now(dev) + cnt_data->min_period);
+	if (near) {
+		rv8803_cnt_expiry_schedule(dev);
+	}
+	k_spin_unlock(&cnt_data->lock, key);
+
+	if (near) {
+		return 0;
+	}
+
+	/* Inside the loaded timer period the timer is reloaded, else the next preset is shaped */
+	err = (target < end) ? rv8803_cnt_virtual_load(dev) : rv8803_cnt_virtual_preset(dev);
+	if (err < 0) {
+		key = k_spin_lock(&cnt_data->lock);
+		cnt_data->alarm.callback = NULL;
+		k_spin_unlock(&cnt_data->lock, key);
+	}
+
+	return err;
+}
+
+static int rv8803_cnt_set_alarm(const struct device *dev, uint8_t chan_id,
+				const struct counter_alarm_cfg *alarm_cfg)
 {
 	const struct rv8803_cnt_config *cnt_config = dev->config;
-	const struct rv8803_config *config = cnt_config->base_dev->config;
+	struct rv8803_cnt_data *cnt_data = dev->data;
+	bool absolute = (alarm_cfg->flags & COUNTER_ALARM_CFG_ABSOLUTE) != 0;
+	enum rv8803_bus_caller caller;
+	k_spinlock_key_t key;
+	uint32_t distance;
+	uint32_t value;
+	uint64_t now;
+	bool late;
 	int err;
 
-	if ((cfg->ticks <= 0) || (cfg->ticks >= RV8803_COUNTER_MAX_TOP_VALUE)) {
+	caller = rv8803_bus_lock(cnt_config->base_dev, RV8803_BUS_CALLER_COUNTER);
+	key = k_spin_lock(&cnt_data->lock);
+	if (cnt_data->alarm.callback != NULL) {
+		err = -EBUSY;
+		goto unlock;
+	}
+	if (alarm_cfg->ticks > (absolute ? (cnt_data->top - 1) : cnt_data->top)) {
+		err = -EINVAL;
+		goto unlock;
+	}
+
+	now = rv8803_cnt_now(dev);
+	value = now - cnt_data->period_start;
+	if (absolute) {
+		distance = (alarm_cfg->ticks >= value) ? (alarm_cfg->ticks - value)
+						       : (cnt_data->top - value + alarm_cfg->ticks);
+		/* At the current value, or behind it within the guard period */
+		late = (distance == 0) || ((cnt_data->top - distance) <= cnt_data->guard);
+	} else {
+		distance = alarm_cfg->ticks;
+		late = (distance == 0);
+	}
+
+	if (late) {
+		k_spin_unlock(&cnt_data->lock, key);
+		rv8803_bus_unlock(cnt_config->base_dev, caller);
+
+		if (!absolute || (alarm_cfg->flags & COUNTER_ALARM_CFG_EXPIRE_WHEN_LATE)) {
+			alarm_cfg->callback(dev, chan_id, value, alarm_cfg->user_data);
+		}
+
+		return absolute ? -ETIME : 0;
+	}
+
+	k_spin_unlock(&cnt_data->lock, key);
+	err = rv8803_cnt_alarm_arm(dev, now + distance, alarm_cfg->callback, alarm_cfg->user_data);
+	rv8803_bus_unlock(cnt_config->base_dev, caller);
+
+	return err;
+
+unlock:
+	k_spin_unlock(&cnt_data->lock, key);
+	rv8803_bus_unlock(cnt_config->base_dev, caller);
+
+	return err;
+}
+
+static int rv8803_cnt_cancel_alarm(const struct device *dev, uint8_t chan_id)
+{
+	struct rv8803_cnt_data *cnt_data = dev->data;
+	k_spinlock_key_t key;
+	int err = 0;
+
+	ARG_UNUSED(chan_id);
+
+	/* A timer period shaped for the alarm only costs an extra reload */
+	key = k_spin_lock(&cnt_data->lock);
+#if CONFIG_RV8803_COUNTER_TIMERS
+	if (cnt_data->alarm.callback == rv8803_cnt_timer_expire) {
+		err = -EBUSY;
+	} else {
+		cnt_data->alarm.callback = NULL;
+	}
+#else
+	cnt_data->alarm.callback = NULL;
+#endif /* CONFIG_RV8803_COUNTER_TIMERS */
+	k_spin_unlock(&cnt_data->lock, key);
+
+	return err;
+}
+
+static int rv8803_cnt_set_guard_period(const struct device *dev, uint32_t ticks, uint32_t flags)
+{
+	struct rv8803_cnt_data *cnt_data = dev->data;
+
+	ARG_UNUSED(flags);
+
+	if (ticks >= cnt_data->top) {
 		return -EINVAL;
 	}
 
-	/* TE, TIE and TF to 0 : stop interrupt */
-	err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_EXTENSION,
-				     RV8803_EXTENSION_MASK_COUNTER, RV8803_DISABLE_COUNTER);
+	cnt_data->guard = ticks;
+
+	return 0;
+}
+
+static uint32_t rv8803_cnt_get_guard_period(const struct device *dev, uint32_t flags)
+{
+	const struct rv8803_cnt_data *cnt_data = dev->data;
+
+	ARG_UNUSED(flags);
+
+	return cnt_data->guard;
+}
+
+#if CONFIG_RV8803_COUNTER_TIMERS
+/* Called with the timer lock held: sorted by expiry, equal expiries keep their start order */
+static void rv8803_cnt_timer_insert(struct rv8803_cnt_data *cnt_data,
+				    struct rv8803_cnt_timer *timer)
+{
+	struct rv8803_cnt_timer *entry;
+	struct rv8803_cnt_timer *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&cnt_data->timers, entry, node) {
+		if (entry->expiry > timer->expiry) {
+			break;
+		}
+		prev = entry;
+	}
+
+	if (prev == NULL) {
+		sys_slist_prepend(&cnt_data->timers, &timer->node);
+	} else {
+		sys_slist_insert(&cnt_data->timers, &prev->node, &timer->node);
+	}
+}
+
+/*
+ * Called with the timer lock held: arms the channel alarm on the nearest expiry. Returns 1 when
+ * the nearest timer is already due within the slack window.
+ */
+static int rv8803_cnt_timer_program(const struct device *dev)
+{
+	const struct rv8803_cnt_config *cnt_config = dev->config;
+	struct rv8803_cnt_data *cnt_data = dev->data;
+	struct rv8803_cnt_timer *head;
+	enum rv8803_bus_caller caller;
+	k_spinlock_key_t key;
+	uint64_t now;
+	int err = 0;
+
+	head = SYS_SLIST_PEEK_HEAD_CONTAINER(&cnt_data->timers, head, node);
+
+	caller = rv8803_bus_lock(cnt_config->base_dev, RV8803_BUS_CALLER_COUNTER);
+	key = k_spin_lock(&cnt_data->lock);
+	if ((cnt_data->alarm.callback != NULL) &&
+	    (cnt_data->alarm.callback != rv8803_cnt_timer_expire)) {
+		err = -EBUSY;
+	} else {
+		cnt_data->alarm.callback = NULL;
+	}
+	now = rv8803_cnt_now(dev);
+	k_spin_unlock(&cnt_data->lock, key);
+
+	if ((err == 0) && (head != NULL) && (head->expiry <= (now + cnt_data->slack))) {
+		err = 1;
+	} else if ((err == 0) && (head != NULL)) {
+		err = rv8803_cnt_alarm_arm(dev, head->expiry, rv8803_cnt_timer_expire, NULL);
+	}
+	rv8803_bus_unlock(cnt_config->base_dev, caller);
+
+	return err;
+}
+
+/* Calls every timer due within the slack window in one pass, then arms the nearest expiry */
+static int rv8803_cnt_timer_run(const struct device *dev)
+{
+	struct rv8803_cnt_data *cnt_data = dev->data;
+	struct rv8803_cnt_timer *timer;
+	uint64_t horizon;
+	int err;
+
+	k_mutex_lock(&cnt_data->timer_lock, K_FOREVER);
+	do {
+		rv8803_cnt_get_value_64(dev, &horizon);
+		horizon += cnt_data->slack;
+
+		while (((timer = SYS_SLIST_PEEK_HEAD_CONTAINER(&cnt_data->timers, timer, node)) !=
+			NULL) &&
+		       (timer->expiry <= horizon)) {
+			sys_slist_get(&cnt_data->timers);
+
+			/* Rescheduled first, the handler may stop it: missed periods skipped */
+			if (timer->period != 0) {
+				timer->expiry += ((horizon - timer->expiry) / timer->period + 1) *
+						 (uint64_t)timer->period;
+				rv8803_cnt_timer_insert(cnt_data, timer);
+			}
+			timer->handler(timer, timer->user_data);
+		}
+
+		err = rv8803_cnt_timer_program(dev);
+	} while (err > 0);
+	k_mutex_unlock(&cnt_data->timer_lock);
+
+	return err;
+}
+
+static void rv8803_cnt_timer_expire(const struct device *dev, uint8_t chan_id, uint32_t ticks,
+				    void *user_data)
+{
+	ARG_UNUSED(chan_id);
+	ARG_UNUSED(ticks);
+	ARG_UNUSED(user_data);
+
+	int err = rv8803_cnt_timer_run(dev);
+
 	if (err < 0) {
-		return err;
+		LOG_ERR("Failed to arm the next timer [%d]", err);
+	}
+}
+
+int rv8803_cnt_timer_start(const struct device *dev, struct rv8803_cnt_timer *timer,
+			   uint32_t delay, uint32_t period)
+{
+	struct rv8803_cnt_data *cnt_data = dev->data;
+	uint64_t now;
+	int err = 0;
+
+	if ((timer == NULL) || (timer->handler == NULL)) {
+		return -EINVAL;
+	}
+
+	/* A started timer is restarted */
+	k_mutex_lock(&cnt_data->timer_lock, K_FOREVER);
+	sys_slist_find_and_remove(&cnt_data->timers, &timer->node);
+	rv8803_cnt_get_value_64(dev, &now);
+	timer->expiry = now + delay;
+	timer->period = period;
+	rv8803_cnt_timer_insert(cnt_data, timer);
+	if (sys_slist_peek_head(&cnt_data->timers) == &timer->node) {
+		err = rv8803_cnt_timer_program(dev);
 	}
-	err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_CONTROL,
-				     RV8803_CONTROL_MASK_COUNTER, RV8803_DISABLE_COUNTER);
 	if (err < 0) {
-		return err;
+		sys_slist_find_and_remove(&cnt_data->timers, &timer->node);
+	}
+	k_mutex_unlock(&cnt_data->timer_lock);
+
+	/* Due at once: handled in the caller context */
+	if (err > 0) {
+		err = rv8803_cnt_timer_run(dev);
+	}
+
+	return err;
+}
+
+int rv8803_cnt_timer_stop(const struct device *dev, struct rv8803_cnt_timer *timer)
+{
+	struct rv8803_cnt_data *cnt_data = dev->data;
+	bool head;
+	int err = 0;
+
+	if (timer == NULL) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&cnt_data->timer_lock, K_FOREVER);
+	head = (sys_slist_peek_head(&cnt_data->timers) == &timer->node);
+	if (!sys_slist_find_and_remove(&cnt_data->timers, &timer->node)) {
+		err = -ENOENT;
+	} else if (head) {
+		err = rv8803_cnt_timer_program(dev);
+	}
+	k_mutex_unlock(&cnt_data->timer_lock);
+
+	/* The next timer became due meanwhile */
+	if (err > 0) {
+		err = rv8803_cnt_timer_run(dev);
 	}
-	err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_FLAG,
-				     RV8803_FLAG_MASK_COUNTER, RV8803_DISABLE_COUNTER);
+
+	return err;
+}
+#endif /* CONFIG_RV8803_COUNTER_TIMERS */
+#endif /* CONFIG_RV8803_COUNTER_VIRTUAL */
+
+static int rv8803_cnt_start(const struct device *dev)
+{
+	const struct rv8803_cnt_config *cnt_config = dev->config;
+	enum rv8803_bus_caller caller;
+	int err;
+
+	caller = rv8803_bus_lock(cnt_config->base_dev, RV8803_BUS_CALLER_COUNTER);
+#if CONFIG_RV8803_COUNTER_VIRTUAL
+	err = rv8803_cnt_virtual_load(dev);
+#else
+	err = rv8803_bus_reg_update(cnt_config->base_dev, RV8803_REGISTER_EXTENSION,
+				    RV8803_EXTENSION_MASK_COUNTER, RV8803_ENABLE_COUNTER);
+#endif /* CONFIG_RV8803_COUNTER_VIRTUAL */
+	rv8803_bus_unlock(cnt_config->base_dev, caller);
 	if (err < 0) {
 		return err;
 	}
 
-	/* Choose TD clock frequency */
-	uint8_t value;
-	switch (cnt_config->info.freq) {
-	case 4096:
-		value = RV8803_COUNTER_FREQUENCY_4096_HZ;
-		break;
+	return 0;
+}
 
-	case 64:
-		value = RV8803_COUNTER_FREQUENCY_64_HZ;
-		break;
+static int rv8803_cnt_stop(const struct device *dev)
+{
+	const struct rv8803_cnt_config *cnt_config = dev->config;
+	enum rv8803_bus_caller caller;
+	int err;
 
-	case 1:
-		value = RV8803_COUNTER_FREQUENCY_1_HZ;
-		break;
+	caller = rv8803_bus_lock(cnt_config->base_dev, RV8803_BUS_CALLER_COUNTER);
+	err = rv8803_bus_reg_update(cnt_config->base_dev, RV8803_REGISTER_EXTENSION,
+				    RV8803_EXTENSION_MASK_COUNTER, RV8803_DISABLE_COUNTER);
+#if CONFIG_RV8803_COUNTER_VIRTUAL
+	/* The value holds until the next start */
+	if (err == 0) {
+		struct rv8803_cnt_data *cnt_data = dev->data;
+		k_spinlock_key_t key = k_spin_lock(&cnt_data->lock);
 
-	default:
-		return -EINVAL;
+		cnt_data->total = rv8803_cnt_now(dev);
+		cnt_data->running = false;
+		k_spin_unlock(&cnt_data->lock, key);
 	}
-	err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_EXTENSION,
-				     RV8803_FREQUENCY_MASK_COUNTER, value);
+#endif /* CONFIG_RV8803_COUNTER_VIRTUAL */
+	rv8803_bus_unlock(cnt_config->base_dev, caller);
 	if (err < 0) {
 		return err;
 	}
 
-	/* Choose TC0/TC1 counter period */
-	value = cfg->ticks & 0xFF;
-	err = i2c_reg_write_byte_dt(&config->i2c_bus, RV8803_REGISTER_TIMER_COUNTER_0, value);
+	return 0;
+}
+
+#if !CONFIG_RV8803_COUNTER_VIRTUAL
+/* Called with the bus locked: TE to 0 with TD, TC0/TC1, TF to 0 and TIE to 1 in a single plan */
+static int rv8803_cnt_program(const struct device *dev, uint16_t ticks, uint8_t value, bool enable)
+{
+	const struct rv8803_cnt_config *cnt_config = dev->config;
+	struct rv8803_bus_plan plan;
+	int err;
+
+	rv8803_bus_plan_init(&plan);
+
+	/* TE to 0 and TD in a single write : TIE can stay set while the timer is stopped */
+	err = rv8803_bus_plan_update(cnt_config->base_dev, &plan, RV8803_REGISTER_EXTENSION,
+				     RV8803_EXTENSION_MASK_COUNTER | RV8803_FREQUENCY_MASK_COUNTER,
+				     RV8803_DISABLE_COUNTER | value);
 	if (err < 0) {
 		return err;
 	}
-	value = (cfg->ticks >> 8) & 0x0F;
-	err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_TIMER_COUNTER_1, 0x0F,
-				     value);
+
+	/* Choose TC0/TC1 counter period, TE back to 1 to reload it when asked */
+	err = rv8803_bus_plan_update(cnt_config->base_dev, &plan, RV8803_REGISTER_TIMER_COUNTER_0,
+				     0xFF, ticks & 0xFF);
+	if (err == 0) {
+		err = rv8803_bus_plan_update(cnt_config->base_dev, &plan,
+					     RV8803_REGISTER_TIMER_COUNTER_1, 0x0F, ticks >> 8);
+	}
+	if ((err == 0) && enable) {
+		err = rv8803_bus_plan_update(cnt_config->base_dev, &plan, RV8803_REGISTER_EXTENSION,
+					     RV8803_EXTENSION_MASK_COUNTER, RV8803_ENABLE_COUNTER);
+	}
 	if (err < 0) {
 		return err;
 	}
 
-	/* TIE to 1 : enable interrupt */
-	err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_CONTROL,
+	/* TF to 0 : clear pending interrupt, TIE to 1 : enable interrupt (0x0E - 0x0F) */
+	rv8803_bus_plan_flag_clear(&plan, RV8803_FLAG_MASK_COUNTER);
+	err = rv8803_bus_plan_update(cnt_config->base_dev, &plan, RV8803_REGISTER_CONTROL,
 				     RV8803_CONTROL_MASK_COUNTER, RV8803_ENABLE_COUNTER);
+	if (err == 0) {
+		err = rv8803_bus_plan_commit(cnt_config->base_dev, &plan);
+	}
 	if (err < 0) {
 		return err;
 	}
 
-	/* Register callback */
+#if RV8803_HAS_IRQ
+	/* TF cleared above: nothing pending for the new period */
+	rv8803_irq_pending_clear(cnt_config->base_dev, RV8803_FLAG_MASK_COUNTER);
+#endif /* RV8803_HAS_IRQ */
+
+	return 0;
+}
+
+/*
+ * Called with the bus locked: the running timer loads the new period at the next reload. Only the
+ * changed preset registers are written, a new TD waits for the reload in the interrupt worker.
+ */
+static int rv8803_cnt_retune(const struct device *dev, uint16_t ticks, uint8_t value)
+{
+	const struct rv8803_cnt_config *cnt_config = dev->config;
+	struct rv8803_cnt_data *cnt_data = dev->data;
+	struct rv8803_bus_plan plan;
+	uint8_t extension;
+	int err;
+
+	/* Served from the shadow copy */
+	err = rv8803_bus_reg_read(cnt_config->base_dev, RV8803_REGISTER_EXTENSION, &extension);
+	if (err < 0) {
+		return err;
+	}
+
+	cnt_data->reload_ticks = 0;
+	if (!(extension & RV8803_EXTENSION_MASK_COUNTER)) {
+		return rv8803_cnt_program(dev, ticks, value, false);
+	}
+	if ((extension & RV8803_FREQUENCY_MASK_COUNTER) != value) {
+		cnt_data->reload_ticks = ticks;
+		cnt_data->reload_td = value;
+		return 0;
+	}
+
+	rv8803_bus_plan_init(&plan);
+	err = rv8803_bus_plan_update(cnt_config->base_dev, &plan, RV8803_REGISTER_TIMER_COUNTER_0,
+				     0xFF, ticks & 0xFF);
+	if (err == 0) {
+		err = rv8803_bus_plan_update(cnt_config->base_dev, &plan,
+					     RV8803_REGISTER_TIMER_COUNTER_1, 0x0F, ticks >> 8);
+	}
+	if (err == 0) {
+		err = rv8803_bus_plan_commit(cnt_config->base_dev, &plan);
+	}
+
+	return err;
+}
+#endif /* !CONFIG_RV8803_COUNTER_VIRTUAL */
+
+static int rv8803_cnt_set_top_value(const struct device *dev, const struct counter_top_cfg *cfg)
+{
+	const struct rv8803_cnt_config *cnt_config = dev->config;
 	struct rv8803_cnt_data *cnt_data = dev->data;
+	enum rv8803_bus_caller caller;
+	int err;
+
+#if CONFIG_RV8803_COUNTER_VIRTUAL
+	k_spinlock_key_t key;
+	bool reload;
+	uint64_t now;
+
+	if (cfg->ticks == 0) {
+		return -EINVAL;
+	}
+
+	/* Kept in RAM, the counter restarts from 0 with the new top unless asked otherwise */
+	caller = rv8803_bus_lock(cnt_config->base_dev, RV8803_BUS_CALLER_COUNTER);
+	key = k_spin_lock(&cnt_data->lock);
+	if (cnt_data->alarm.callback != NULL) {
+		k_spin_unlock(&cnt_data->lock, key);
+		rv8803_bus_unlock(cnt_config->base_dev, caller);
+		return -EBUSY;
+	}
+	now = rv8803_cnt_now(dev);
+	err = 0;
+	if (cfg->flags & COUNTER_TOP_CFG_DONT_RESET) {
+		/* Already beyond the new top: the period restarts anyway */
+		if ((now - cnt_data->period_start) >= cfg->ticks) {
+			cnt_data->period_start = now;
+			err = -ETIME;
+		}
+	} else {
+		cnt_data->period_start = now;
+	}
+	cnt_data->top = cfg->ticks;
 	cnt_data->counter_cb = cfg->callback;
 	cnt_data->user_data = cfg->user_data;
 
-	return 0;
+	/* The timer is only reloaded when the loaded period crosses the new top */
+	reload = (now + rv8803_cnt_boundary(cnt_data, now)) <
+		 (cnt_data->total + cnt_data->hw_current);
+	k_spin_unlock(&cnt_data->lock, key);
+	if (cnt_data->running) {
+		int ret = reload ? rv8803_cnt_virtual_load(dev) : rv8803_cnt_virtual_preset(dev);
+
+		err = (ret < 0) ? ret : err;
+	}
+	rv8803_bus_unlock(cnt_config->base_dev, caller);
+
+	return err;
+#else
+	uint32_t ticks = cfg->ticks;
+	uint8_t value;
+
+#if CONFIG_RV8803_COUNTER_AUTO_PRESCALER
+	/* Choose TD clock frequency from the period */
+	err = rv8803_cnt_prescale(cnt_config->info.freq, &ticks, &value);
+	if (err < 0) {
+		return err;
+	}
+#else
+	if ((cfg->ticks <= 0) || (cfg->ticks >= RV8803_COUNTER_MAX_TOP_VALUE)) {
+		return -EINVAL;
+	}
+
+	/* Choose TD clock frequency */
+	err = rv8803_cnt_td(cnt_config->info.freq, &value);
+	if (err < 0) {
+		return err;
+	}
+#endif /* CONFIG_RV8803_COUNTER_AUTO_PRESCALER */
+
+	caller = rv8803_bus_lock(cnt_config->base_dev, RV8803_BUS_CALLER_COUNTER);
+	if (cfg->flags & COUNTER_TOP_CFG_DONT_RESET) {
+		err = rv8803_cnt_retune(dev, ticks, value);
+	} else {
+		cnt_data->reload_ticks = 0;
+		err = rv8803_cnt_program(dev, ticks, value, false);
+	}
+	if (err < 0) {
+		goto unlock;
+	}
+
+	/* Register callback */
+	cnt_data->counter_cb = cfg->callback;
+	cnt_data->user_data = cfg->user_data;
+#if CONFIG_RV8803_COUNTER_AUTO_PRESCALER
+	if (cnt_data->reload_ticks == 0) {
+		cnt_data->td = value;
+	}
+#endif /* CONFIG_RV8803_COUNTER_AUTO_PRESCALER */
+
+unlock:
+	rv8803_bus_unlock(cnt_config->base_dev, caller);
+
+	return err;
+#endif /* CONFIG_RV8803_COUNTER_VIRTUAL */
 }
 
 static uint32_t rv8803_cnt_get_top_value(const struct device *dev)
 {
+#if CONFIG_RV8803_COUNTER_VIRTUAL
+	const struct rv8803_cnt_data *cnt_data = dev->data;
+
+	return cnt_data->top;
+#else
 	const struct rv8803_cnt_config *cnt_config = dev->config;
-	const struct rv8803_config *config = cnt_config->base_dev->config;
+	enum rv8803_bus_caller caller;
 	uint8_t regs[2];
 	int err;
 
-	err = i2c_burst_read_dt(&config->i2c_bus, RV8803_REGISTER_TIMER_COUNTER_0, regs,
-				sizeof(regs));
+	/* Served from the shadow copy */
+	caller = rv8803_bus_lock(cnt_config->base_dev, RV8803_BUS_CALLER_COUNTER);
+	err = rv8803_bus_burst_read(cnt_config->base_dev, RV8803_REGISTER_TIMER_COUNTER_0, regs,
+				    sizeof(regs));
+	rv8803_bus_unlock(cnt_config->base_dev, caller);
 	if (err < 0) {
 		return err;
 	}
 
+#if CONFIG_RV8803_COUNTER_AUTO_PRESCALER
+	/* Back to ticks of the devicetree frequency */
+	const struct rv8803_cnt_data *cnt_data = dev->data;
+	uint64_t top = ((regs[1] & 0x0F) << 8) | ((regs[0] & 0xFF) << 0);
+
+	return DIV_ROUND_CLOSEST(top * cnt_config->info.freq * rv8803_cnt_clock_den[cnt_data->td],
+				 rv8803_cnt_clock_num[cnt_data->td]);
+#else
 	return (((regs[1] & 0x0F) << 8) | ((regs[0] & 0xFF) << 0));
+#endif /* CONFIG_RV8803_COUNTER_AUTO_PRESCALER */
+#endif /* CONFIG_RV8803_COUNTER_VIRTUAL */
 }
 
 static uint32_t rv8803_cnt_get_pending_int(const struct device *dev)
 {
 	const struct rv8803_cnt_config *cnt_config = dev->config;
-	const struct rv8803_config *config = cnt_config->base_dev->config;
+	enum rv8803_bus_caller caller;
 	uint8_t reg;
 	int err;
 
-	err = i2c_reg_read_byte_dt(&config->i2c_bus, RV8803_REGISTER_FLAG, &reg);
+#if RV8803_HAS_IRQ
+	/* Interrupt wired: TF is latched by the dispatcher */
+	const struct rv8803_config *config = cnt_config->base_dev->config;
+	if (config->gpio->irq_gpio.port != NULL) {
+		return (rv8803_irq_pending_get(cnt_config->base_dev) & RV8803_FLAG_MASK_COUNTER);
+	}
+#endif /* RV8803_HAS_IRQ */
+
+	caller = rv8803_bus_lock(cnt_config->base_dev, RV8803_BUS_CALLER_COUNTER);
+	err = rv8803_bus_reg_read(cnt_config->base_dev, RV8803_REGISTER_FLAG, &reg);
+	rv8803_bus_unlock(cnt_config->base_dev, caller);
 	if (err < 0) {
 		return err;
 	}
@@ -155,35 +1023,67 @@ static uint32_t rv8803_cnt_get_pending_int(const struct device *dev)
 }
 
 #if RV8803_HAS_IRQ
-static void rv8803_cnt_worker(struct k_work *p_work)
+static uint8_t rv8803_cnt_irq_handler(const struct device *dev, const struct rv8803_event *event)
 {
-	struct rv8803_irq *data = CONTAINER_OF(p_work, struct rv8803_irq, cnt_work);
-	const struct rv8803_cnt_config *cnt_config = data->cnt_dev->config;
-	const struct rv8803_cnt_data *cnt_data = data->cnt_dev->data;
-	const struct rv8803_config *config = cnt_config->base_dev->config;
-	uint8_t reg;
-	int err;
+	const struct rv8803_cnt_config *cnt_config = dev->config;
+	struct rv8803_cnt_data *cnt_data = dev->data;
 
-	LOG_DBG("Process Counter worker from interrupt");
+	LOG_DBG("Process Counter event from interrupt");
 
-	err = i2c_reg_read_byte_dt(&config->i2c_bus, RV8803_REGISTER_FLAG, &reg);
-	if (err < 0) {
-		LOG_ERR("Counter worker I2C read FLAGS error");
+	if (!(event->flag & RV8803_FLAG_MASK_COUNTER)) {
+		return 0;
 	}
 
-	if (reg & RV8803_FLAG_MASK_COUNTER) {
-		if (cnt_data->counter_cb != NULL) {
-			LOG_DBG("Calling Counter callback");
-			cnt_data->counter_cb(data->cnt_dev, cnt_data->user_data);
+#if CONFIG_RV8803_COUNTER_VIRTUAL
+	struct rv8803_cnt_alarm expired = {0};
+	enum rv8803_bus_caller caller;
+	uint32_t value;
+	bool wrapped;
 
-			err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_FLAG,
-						     RV8803_FLAG_MASK_COUNTER,
-						     RV8803_DISABLE_COUNTER);
-			if (err < 0) {
-				LOG_ERR("GPIO worker I2C update ALARM FLAG error");
-			}
+	caller = rv8803_bus_lock(cnt_config->base_dev, RV8803_BUS_CALLER_COUNTER);
+	wrapped = rv8803_cnt_virtual_reload(dev, event, &expired, &value);
+	rv8803_bus_unlock(cnt_config->base_dev, caller);
+
+	/* One-shot: the callback may arm the next alarm */
+	if (expired.callback != NULL) {
+		LOG_DBG("Calling Counter alarm callback");
+		expired.callback(dev, 0, value, expired.user_data);
+	}
+
+	/* Reloads inside the top period are not reported */
+	if (!wrapped) {
+		rv8803_irq_pending_clear(cnt_config->base_dev, RV8803_FLAG_MASK_COUNTER);
+		return RV8803_FLAG_MASK_COUNTER;
+	}
+#else
+	/* Period retuned with a new TD: the timer restarts right after the reload */
+	enum rv8803_bus_caller caller;
+
+	caller = rv8803_bus_lock(cnt_config->base_dev, RV8803_BUS_CALLER_COUNTER);
+	if (cnt_data->reload_ticks != 0) {
+		int err;
+
+		err = rv8803_cnt_program(dev, cnt_data->reload_ticks, cnt_data->reload_td, true);
+		if (err < 0) {
+			LOG_ERR("Failed to reload the timer period [%d]", err);
 		}
+#if CONFIG_RV8803_COUNTER_AUTO_PRESCALER
+		cnt_data->td = cnt_data->reload_td;
+#endif /* CONFIG_RV8803_COUNTER_AUTO_PRESCALER */
+		cnt_data->reload_ticks = 0;
 	}
+	rv8803_bus_unlock(cnt_config->base_dev, caller);
+#endif /* CONFIG_RV8803_COUNTER_VIRTUAL */
+
+	/* Without callback TF stays pending in RAM only, INT is released for the other events */
+	if (cnt_data->counter_cb != NULL) {
+		LOG_DBG("Calling Counter callback");
+		rv8803_irq_pending_clear(cnt_config->base_dev, RV8803_FLAG_MASK_COUNTER);
+		cnt_data->counter_cb(dev, cnt_data->user_data);
+		rv8803_latency_record(cnt_config->base_dev, RV8803_EVENT_TIMER, event);
+	}
+
+	return RV8803_FLAG_MASK_COUNTER;
 }
 #endif /* RV8803_HAS_IRQ */
 
@@ -198,11 +1098,33 @@ static int rv8803_cnt_init(const struct device *dev)
 	LOG_INF("RV8803 CNT: FREQ[%d]", cnt_config->info.freq);
 	LOG_INF("RV8803 CNT INIT");
 
-#if RV8803_HAS_IRQ
-	struct rv8803_data *data = cnt_config->base_dev->data;
+#if CONFIG_RV8803_COUNTER_VIRTUAL
+	/* Free running on 32 bits until a top value is set */
+	struct rv8803_cnt_data *cnt_data = dev->data;
+	cnt_data->top = RV8803_COUNTER_TOP_VALUE_LIMIT;
+	cnt_data->min_period = RV8803_COUNTER_MIN_PERIOD(cnt_config->info.freq);
+	cnt_data->dev = dev;
+	k_work_init_delayable(&cnt_data->expiry_work, rv8803_cnt_expiry_work);
+#endif /* CONFIG_RV8803_COUNTER_VIRTUAL */
+
+#if CONFIG_RV8803_COUNTER_TIMERS
+	k_mutex_init(&cnt_data->timer_lock);
+	sys_slist_init(&cnt_data->timers);
+	cnt_data->slack = (uint64_t)CONFIG_RV8803_COUNTER_TIMER_SLACK_MS * cnt_config->info.freq /
+			  MSEC_PER_SEC;
+#endif /* CONFIG_RV8803_COUNTER_TIMERS */
 
-	data->irq->cnt_dev = dev;
-	data->irq->cnt_work.handler = rv8803_cnt_worker;
+#if CONFIG_RV8803_COUNTER_AUTO_PRESCALER
+	/* Devicetree clock until a top value is set */
+	struct rv8803_cnt_data *cnt_data = dev->data;
+	if (rv8803_cnt_td(cnt_config->info.freq, &cnt_data->td) < 0) {
+		return -EINVAL;
+	}
+#endif /* CONFIG_RV8803_COUNTER_AUTO_PRESCALER */
+
+#if RV8803_HAS_IRQ
+	rv8803_irq_register(cnt_config->base_dev, RV8803_IRQ_SLOT_CNT, RV8803_FLAG_MASK_COUNTER,
+			    rv8803_cnt_irq_handler, dev);
 #else
 	LOG_ERR("RV8803 PARENT: Missing IRQ!");
 	return -ENODEV;
@@ -218,15 +1140,32 @@ static const struct counter_driver_api rv8803_cnt_driver_api = {
 	.set_top_value = rv8803_cnt_set_top_value,
 	.get_top_value = rv8803_cnt_get_top_value,
 	.get_pending_int = rv8803_cnt_get_pending_int,
+#if CONFIG_RV8803_COUNTER_VIRTUAL
+	.get_value = rv8803_cnt_get_value,
+	.get_value_64 = rv8803_cnt_get_value_64,
+	.set_alarm = rv8803_cnt_set_alarm,
+	.cancel_alarm = rv8803_cnt_cancel_alarm,
+	.set_guard_period = rv8803_cnt_set_guard_period,
+	.get_guard_period = rv8803_cnt_get_guard_period,
+#endif /* CONFIG_RV8803_COUNTER_VIRTUAL */
 };
 
+/* Devicetree frequency of an instance */
+#define RV8803_CNT_FREQUENCY(n) rv8803_frequency[DT_INST_ENUM_IDX(n, frequency)]
+
 /* RV8803 CNT Initialization MACRO */
 #define RV8803_CNT_INIT(n)                                                                         \
 	static const struct rv8803_cnt_config rv8803_cnt_config_##n = {                            \
 		.info =                                                                            \
 			{                                                                          \
-				.max_top_value = RV8803_COUNTER_MAX_TOP_VALUE,                     \
-				.freq = rv8803_frequency[DT_INST_ENUM_IDX(n, frequency)],          \
+				.max_top_value = COND_CODE_1(                                      \
+					CONFIG_RV8803_COUNTER_AUTO_PRESCALER,                      \
+					(RV8803_COUNTER_PRESCALED_TOP_VALUE_LIMIT(                 \
+						RV8803_CNT_FREQUENCY(n))),                         \
+					(RV8803_COUNTER_TOP_VALUE_LIMIT)),                         \
+				.freq = RV8803_CNT_FREQUENCY(n),                                   \
+				.flags = COND_CODE_1(CONFIG_RV8803_COUNTER_VIRTUAL,                \
+						     (COUNTER_CONFIG_INFO_COUNT_UP), (0)),         \
 				.channels = RV8803_COUNTER_CHANNELS,                               \
 			},                                                                         \
 		.base_dev = DEVICE_DT_GET(DT_PARENT(DT_INST(n, DT_DRV_COMPAT))),                   \
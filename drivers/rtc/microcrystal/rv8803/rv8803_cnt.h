@@ -21,6 +21,11 @@
 #define RV8803_FREQUENCY_SHIFT_COUNTER 0
 #define RV8803_FREQUENCY_MASK_COUNTER  (0x03 << RV8803_FREQUENCY_SHIFT_COUNTER)
 
+#define RV8803_COUNTER_FREQUENCY_4096_HZ 0x00
+#define RV8803_COUNTER_FREQUENCY_64_HZ   0x01
+#define RV8803_COUNTER_FREQUENCY_1_HZ    0x02
+#define RV8803_COUNTER_FREQUENCY_1_60_HZ 0x03
+
 #if !RV8803_HAS_IRQ
 #warning IRQ not present in parent device
 #endif
@@ -28,12 +33,22 @@
 /* Structs */
 #if CONFIG_COUNTER && CONFIG_RV8803_COUNTER_ENABLE
 
-#define RV8803_COUNTER_CHANNELS          1
 #define RV8803_COUNTER_MAX_TOP_VALUE     0x0FFFU
-#define RV8803_COUNTER_FREQUENCY_4096_HZ 0x00
-#define RV8803_COUNTER_FREQUENCY_64_HZ   0x01
-#define RV8803_COUNTER_FREQUENCY_1_HZ    0x02
-#define RV8803_COUNTER_FREQUENCY_1_60_HZ 0x03
+
+/* Top value accepted by counter_set_top_value(), periods are chained in software beyond 12 bits */
+#if CONFIG_RV8803_COUNTER_VIRTUAL
+#define RV8803_COUNTER_TOP_VALUE_LIMIT UINT32_MAX
+#define RV8803_COUNTER_CHANNELS        1
+/* Shortest chained timer period in ticks of freq: the worker writes the next preset within it */
+#define RV8803_COUNTER_MIN_PERIOD(freq)                                                            \
+	MAX(DIV_ROUND_UP(CONFIG_RV8803_COUNTER_RELOAD_LATENCY_MS * (freq), MSEC_PER_SEC), 1)
+#else
+#define RV8803_COUNTER_TOP_VALUE_LIMIT RV8803_COUNTER_MAX_TOP_VALUE
+#define RV8803_COUNTER_CHANNELS        0 /* No readable count: alarms need the software counter */
+#endif /* CONFIG_RV8803_COUNTER_VIRTUAL */
+
+/* With the automatic prescaler, in ticks of the devicetree frequency: 4095 minutes at 1/60 Hz */
+#define RV8803_COUNTER_PRESCALED_TOP_VALUE_LIMIT(freq) (RV8803_COUNTER_MAX_TOP_VALUE * 60U * (freq))
 
 static const uint16_t rv8803_frequency[3] = {4096, 64, 1}; /* Not supported by Zephyr < 1Hz */
 
@@ -44,10 +59,79 @@ struct rv8803_cnt_config {
 	const struct device *base_dev;   /* Parent device reference */
 };
 
+#if CONFIG_RV8803_COUNTER_VIRTUAL
+/* One-shot channel alarm, armed while callback is set */
+struct rv8803_cnt_alarm {
+	counter_alarm_callback_t callback;
+	void *user_data;
+	uint64_t target; /* Ticks counted at expiry */
+};
+#endif /* CONFIG_RV8803_COUNTER_VIRTUAL */
+
+#if CONFIG_RV8803_COUNTER_TIMERS
+struct rv8803_cnt_timer;
+
+typedef void (*rv8803_cnt_timer_handler_t)(struct rv8803_cnt_timer *timer, void *user_data);
+
+/* Software timer, owned by the caller: expiry and period in counter ticks */
+struct rv8803_cnt_timer {
+	sys_snode_t node;
+	rv8803_cnt_timer_handler_t handler;
+	void *user_data;
+	uint64_t expiry; /* counter_get_value_64() ticks */
+	uint32_t period; /* 0 for one-shot */
+};
+
+#define RV8803_CNT_TIMER_DEFINE(_name, _handler, _user_data)                                       \
+	struct rv8803_cnt_timer _name = {                                                          \
+		.handler = _handler,                                                               \
+		.user_data = _user_data,                                                           \
+	}
+#endif /* CONFIG_RV8803_COUNTER_TIMERS */
+
 /* RV8803 CLK data */
 struct rv8803_cnt_data {
 	counter_top_callback_t counter_cb;
 	void *user_data;
+#if CONFIG_RV8803_COUNTER_VIRTUAL
+	struct k_spinlock lock;
+	const struct device *dev;
+	struct k_work_delayable expiry_work; /* Events inside the loaded timer period */
+	bool running;
+	uint32_t top;          /* Ticks per top period */
+	uint64_t total;        /* Ticks counted at the start of the loaded timer period */
+	uint64_t period_start; /* Ticks counted at the start of the top period */
+	int64_t edge;          /* Kernel ticks at the start of the loaded timer period */
+	uint16_t hw_current;   /* Loaded timer period */
+	uint16_t hw_next;      /* Preset registers, loaded at the next reload */
+	uint16_t min_period;   /* RV8803_COUNTER_MIN_PERIOD() of the counter frequency */
+	struct rv8803_cnt_alarm alarm;
+	uint32_t guard; /* Late window of absolute alarms */
+#endif /* CONFIG_RV8803_COUNTER_VIRTUAL */
+#if CONFIG_RV8803_COUNTER_TIMERS
+	struct k_mutex timer_lock; /* Timer list, held while the handlers are called */
+	sys_slist_t timers;        /* Sorted by expiry */
+	uint32_t slack;            /* Expiries batched with the nearest one, in ticks */
+#endif /* CONFIG_RV8803_COUNTER_TIMERS */
+#if !CONFIG_RV8803_COUNTER_VIRTUAL
+	uint16_t reload_ticks; /* Period waiting for the next reload, 0 when none */
+	uint8_t reload_td;
+#endif /* !CONFIG_RV8803_COUNTER_VIRTUAL */
+#if CONFIG_RV8803_COUNTER_AUTO_PRESCALER
+	uint8_t td; /* Timer clock selected by the last top value */
+#endif /* CONFIG_RV8803_COUNTER_AUTO_PRESCALER */
 };
+
+#if CONFIG_RV8803_COUNTER_TIMERS
+/* Starts or restarts a timer firing after delay ticks, then every period ticks when not 0 */
+int rv8803_cnt_timer_start(const struct device *dev, struct rv8803_cnt_timer *timer,
+			   uint32_t delay, uint32_t period);
+int rv8803_cnt_timer_stop(const struct device *dev, struct rv8803_cnt_timer *timer);
+#endif /* CONFIG_RV8803_COUNTER_TIMERS */
+
+#if CONFIG_RV8803_COUNTER_AUTO_PRESCALER
+/* Timer clock selected by the last counter_set_top_value(): hz / divider, e.g. 1 / 60 */
+void rv8803_cnt_frequency_get(const struct device *dev, uint32_t *hz, uint32_t *divider);
+#endif /* CONFIG_RV8803_COUNTER_AUTO_PRESCALER */
 #endif
 #endif /* ZEPHYR_DRIVERS_RTC_RV8803_CNT_H_ */
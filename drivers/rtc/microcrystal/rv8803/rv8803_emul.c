@@ -0,0 +1,625 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT microcrystal_rv8803_catie
+
+#include <string.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/drivers/gpio/gpio_emul.h>
+#include <zephyr/drivers/rtc.h>
+#include <zephyr/drivers/counter.h>
+#include <zephyr/logging/log.h>
+
+#include "rv8803.h"
+#include "rv8803_rtc.h"
+#include "rv8803_cnt.h"
+#include "rv8803_emul.h"
+
+LOG_MODULE_REGISTER(RV8803_EMUL, CONFIG_RTC_LOG_LEVEL);
+
+/* Extended registers */
+#define RV8803_EMUL_REGISTER_HUNDREDTHS    0x10
+#define RV8803_EMUL_MIRROR_FIRST           0x11
+#define RV8803_EMUL_MIRROR_LAST            0x1F
+#define RV8803_EMUL_REGISTER_HUNDREDTHS_CP 0x20
+#define RV8803_EMUL_REGISTER_SECONDS_CP    0x21
+
+#define RV8803_EMUL_FLAG_MASK_IRQ   GENMASK(5, 2)
+#define RV8803_EMUL_FLAG_MASK_POWER GENMASK(1, 0)
+#define RV8803_EMUL_HUNDREDTH_NS    (NSEC_PER_SEC / 100)
+
+/* TD timer clock as a fraction: 4096 Hz, 64 Hz, 1 Hz and 1/60 Hz */
+static const uint32_t rv8803_emul_timer_num[4] = {4096, 64, 1, 1};
+static const uint32_t rv8803_emul_timer_den[4] = {1, 1, 1, 60};
+
+struct rv8803_emul_cfg {
+	struct gpio_dt_spec irq_gpio;
+};
+
+struct rv8803_emul_data {
+	struct k_spinlock lock;
+	struct k_timer timer;
+	struct k_timer pps_timer;
+	struct gpio_dt_spec pps_gpio;
+	const struct emul *target;
+	uint8_t regs[RV8803_EMUL_REGISTER_COUNT];
+	uint8_t pointer;
+	uint64_t last_ns;
+	uint64_t hundredth_ns; /* Progress toward the next 100th of second */
+	uint64_t timer_acc;    /* Progress toward the next timer tick, in ns * TD numerator */
+	uint16_t timer_count;  /* Current countdown value */
+	uint32_t byte_ns;      /* Emulated bus time per byte read */
+	int32_t drift_ppb;     /* Oscillator error, positive is fast */
+	int64_t drift_acc;     /* Rate correction remainder, in ns * 10^10 */
+	bool irq_asserted;
+	int fail_err; /* Returned by the next transfer when not 0 */
+	struct rv8803_emul_stats stats;
+};
+
+static uint8_t rv8803_emul_addr(uint8_t reg)
+{
+	/* 0x11 - 0x1F mirror 0x00 - 0x0E: calendar, RAM, alarm, timer, EXTENSION and FLAG */
+	if ((reg >= RV8803_EMUL_MIRROR_FIRST) && (reg <= RV8803_EMUL_MIRROR_LAST)) {
+		return reg - RV8803_EMUL_MIRROR_FIRST;
+	}
+
+	return reg;
+}
+
+static uint64_t rv8803_emul_now_ns(void)
+{
+	return k_ticks_to_ns_floor64(k_uptime_ticks());
+}
+
+/* Time keeping */
+static uint8_t rv8803_emul_days_in_month(uint8_t month, uint8_t year)
+{
+	static const uint8_t days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+	if ((month < 1) || (month > 12)) {
+		return 31;
+	}
+	if ((month == 2) && ((year % 4) == 0)) {
+		return 29;
+	}
+
+	return days[month - 1];
+}
+
+static bool rv8803_emul_alarm_match(const uint8_t *regs)
+{
+	uint8_t wada = regs[RV8803_REGISTER_ALARM_WADA];
+
+	if (!(regs[RV8803_REGISTER_ALARM_MINUTES] & RV8803_ALARM_DISABLE_MINUTES) &&
+	    (regs[RV8803_REGISTER_ALARM_MINUTES] != regs[RV8803_REGISTER_MINUTES])) {
+		return false;
+	}
+
+	if (!(regs[RV8803_REGISTER_ALARM_HOURS] & RV8803_ALARM_DISABLE_HOURS) &&
+	    (regs[RV8803_REGISTER_ALARM_HOURS] != regs[RV8803_REGISTER_HOURS])) {
+		return false;
+	}
+
+	if (wada & RV8803_ALARM_DISABLE_WADA) {
+		return true;
+	}
+
+	if (regs[RV8803_REGISTER_EXTENSION] & RV8803_EXTENSION_MASK_WADA) {
+		return (wada & RV8803_DATE_BITS) == regs[RV8803_REGISTER_DATE];
+	}
+
+	return (wada & regs[RV8803_REGISTER_WEEKDAY] & RV8803_WEEKDAY_BITS) != 0;
+}
+
+static void rv8803_emul_minute(uint8_t *regs)
+{
+	uint8_t minutes = bcd2bin(regs[RV8803_REGISTER_MINUTES]) + 1;
+	uint8_t hours = bcd2bin(regs[RV8803_REGISTER_HOURS]);
+	uint8_t date = bcd2bin(regs[RV8803_REGISTER_DATE]);
+	uint8_t month = bcd2bin(regs[RV8803_REGISTER_MONTH]);
+	uint8_t year = bcd2bin(regs[RV8803_REGISTER_YEAR]);
+	uint8_t weekday = regs[RV8803_REGISTER_WEEKDAY];
+
+	if (minutes > 59) {
+		minutes = 0;
+		hours++;
+	}
+	if (hours > 23) {
+		hours = 0;
+		date++;
+		weekday = (weekday << 1) & RV8803_WEEKDAY_BITS;
+		weekday = (weekday == 0) ? 0x01 : weekday;
+	}
+	if (date > rv8803_emul_days_in_month(month, year)) {
+		date = 1;
+		month++;
+	}
+	if (month > 12) {
+		month = 1;
+		year = (year + 1) % 100;
+	}
+
+	regs[RV8803_REGISTER_MINUTES] = bin2bcd(minutes);
+	regs[RV8803_REGISTER_HOURS] = bin2bcd(hours);
+	regs[RV8803_REGISTER_WEEKDAY] = weekday;
+	regs[RV8803_REGISTER_DATE] = bin2bcd(date);
+	regs[RV8803_REGISTER_MONTH] = bin2bcd(month);
+	regs[RV8803_REGISTER_YEAR] = bin2bcd(year);
+
+	if (rv8803_emul_alarm_match(regs)) {
+		regs[RV8803_REGISTER_FLAG] |= RV8803_FLAG_MASK_ALARM;
+	}
+}
+
+static void rv8803_emul_second(uint8_t *regs)
+{
+	uint8_t seconds = bcd2bin(regs[RV8803_REGISTER_SECONDS] & RV8803_SECONDS_BITS) + 1;
+
+	if (seconds > 59) {
+		seconds = 0;
+		rv8803_emul_minute(regs);
+	}
+	regs[RV8803_REGISTER_SECONDS] = bin2bcd(seconds);
+
+	/* USEL selects a second or a minute update event */
+	if ((seconds == 0) || !(regs[RV8803_REGISTER_EXTENSION] & RV8803_EXTENSION_MASK_UPDATE)) {
+		regs[RV8803_REGISTER_FLAG] |= RV8803_FLAG_MASK_UPDATE;
+	}
+}
+
+static void rv8803_emul_advance(struct rv8803_emul_data *data, uint64_t elapsed_ns)
+{
+	uint8_t *regs = data->regs;
+
+	/* RESET holds the prescaler chain */
+	if (regs[RV8803_REGISTER_CONTROL] & RV8803_RESET_BIT) {
+		return;
+	}
+
+	/* Oscillator error corrected by OFFSET, in 0.1 ppb */
+	int32_t offset = (int32_t)(regs[RV8803_REGISTER_OFFSET] & RV8803_OFFSET_BITS) -
+			 ((regs[RV8803_REGISTER_OFFSET] & BIT(5)) ? 64 : 0);
+	int64_t rate = (int64_t)data->drift_ppb * 10 + offset * RV8803_OFFSET_STEP_PPB_X10;
+
+	int64_t scale = NSEC_PER_SEC * 10LL;
+	int64_t correction = (int64_t)(elapsed_ns / scale) * rate;
+
+	data->drift_acc += (int64_t)(elapsed_ns % scale) * rate;
+	correction += data->drift_acc / scale;
+	data->drift_acc %= scale;
+	elapsed_ns += correction;
+
+	/* Calendar */
+	uint64_t steps;
+	data->hundredth_ns += elapsed_ns;
+	steps = data->hundredth_ns / RV8803_EMUL_HUNDREDTH_NS;
+	data->hundredth_ns %= RV8803_EMUL_HUNDREDTH_NS;
+	steps += bcd2bin(regs[RV8803_EMUL_REGISTER_HUNDREDTHS]);
+	regs[RV8803_EMUL_REGISTER_HUNDREDTHS] = bin2bcd(steps % 100);
+	for (uint64_t i = 0; i < (steps / 100); i++) {
+		rv8803_emul_second(regs);
+	}
+
+	/* Countdown timer */
+	if (!(regs[RV8803_REGISTER_EXTENSION] & RV8803_EXTENSION_MASK_COUNTER)) {
+		return;
+	}
+
+	uint8_t td = regs[RV8803_REGISTER_EXTENSION] & RV8803_FREQUENCY_MASK_COUNTER;
+	uint64_t period = (uint64_t)rv8803_emul_timer_den[td] * NSEC_PER_SEC;
+	uint16_t preset = ((regs[RV8803_REGISTER_TIMER_COUNTER_1] & 0x0F) << 8) |
+			  regs[RV8803_REGISTER_TIMER_COUNTER_0];
+	uint64_t ticks;
+
+	data->timer_acc += elapsed_ns * rv8803_emul_timer_num[td];
+	ticks = data->timer_acc / period;
+	data->timer_acc %= period;
+	if ((data->timer_count == 0) || (ticks < data->timer_count)) {
+		data->timer_count -= MIN(ticks, data->timer_count);
+		return;
+	}
+
+	/* Countdown reached zero: TF and reload from the preset registers */
+	ticks -= data->timer_count;
+	regs[RV8803_REGISTER_FLAG] |= RV8803_FLAG_MASK_COUNTER;
+	data->stats.timer_events++;
+	data->timer_count = (preset == 0) ? 0 : (preset - (ticks % preset));
+}
+
+static void rv8803_emul_sync(struct rv8803_emul_data *data)
+{
+	uint64_t now = rv8803_emul_now_ns();
+
+	/* last_ns may be ahead after bus time was emulated */
+	if (now > data->last_ns) {
+		rv8803_emul_advance(data, now - data->last_ns);
+		data->last_ns = now;
+	}
+}
+
+static uint64_t rv8803_emul_next_event_ns(const struct rv8803_emul_data *data)
+{
+	const uint8_t *regs = data->regs;
+	uint8_t control = regs[RV8803_REGISTER_CONTROL];
+	uint8_t extension = regs[RV8803_REGISTER_EXTENSION];
+	uint64_t next = UINT64_MAX;
+
+	if (control & RV8803_RESET_BIT) {
+		return next;
+	}
+
+	uint64_t to_second =
+		(100 - bcd2bin(regs[RV8803_EMUL_REGISTER_HUNDREDTHS])) * RV8803_EMUL_HUNDREDTH_NS -
+		data->hundredth_ns;
+	uint64_t to_minute =
+		to_second + (59 - bcd2bin(regs[RV8803_REGISTER_SECONDS] & RV8803_SECONDS_BITS)) *
+				    NSEC_PER_SEC;
+
+	if (control & RV8803_CONTROL_MASK_UPDATE) {
+		next = (extension & RV8803_EXTENSION_MASK_UPDATE) ? to_minute : to_second;
+	}
+
+	if (control & RV8803_CONTROL_MASK_ALARM) {
+		next = MIN(next, to_minute);
+	}
+
+	if ((control & RV8803_CONTROL_MASK_COUNTER) && (extension & RV8803_EXTENSION_MASK_COUNTER) &&
+	    (data->timer_count > 0)) {
+		uint8_t td = extension & RV8803_FREQUENCY_MASK_COUNTER;
+		uint64_t period = (uint64_t)rv8803_emul_timer_den[td] * NSEC_PER_SEC;
+		uint64_t left = data->timer_count * period - data->timer_acc;
+
+		next = MIN(next, DIV_ROUND_UP(left, rv8803_emul_timer_num[td]));
+	}
+
+	return next;
+}
+
+/* Called with the lock held, returns the INT line state */
+static bool rv8803_emul_schedule(struct rv8803_emul_data *data)
+{
+	const uint8_t *regs = data->regs;
+	uint64_t next = rv8803_emul_next_event_ns(data);
+
+	if (next == UINT64_MAX) {
+		k_timer_stop(&data->timer);
+	} else {
+		k_timer_start(&data->timer, K_NSEC(MAX(next, 1)), K_NO_WAIT);
+	}
+
+	return (regs[RV8803_REGISTER_FLAG] & regs[RV8803_REGISTER_CONTROL] &
+		RV8803_EMUL_FLAG_MASK_IRQ) != 0;
+}
+
+static void rv8803_emul_set_irq(struct rv8803_emul_data *data, bool asserted)
+{
+	const struct rv8803_emul_cfg *cfg = data->target->cfg;
+
+	if ((cfg->irq_gpio.port == NULL) || (asserted == data->irq_asserted)) {
+		return;
+	}
+	data->irq_asserted = asserted;
+
+#if CONFIG_GPIO_EMUL
+	/* INT is an open drain output, active low */
+	gpio_emul_input_set(cfg->irq_gpio.port, cfg->irq_gpio.pin, asserted ? 0 : 1);
+#endif /* CONFIG_GPIO_EMUL */
+}
+
+static void rv8803_emul_refresh(struct rv8803_emul_data *data)
+{
+	bool irq = false;
+
+	K_SPINLOCK(&data->lock) {
+		rv8803_emul_sync(data);
+		irq = rv8803_emul_schedule(data);
+	}
+
+	rv8803_emul_set_irq(data, irq);
+}
+
+static void rv8803_emul_timer_handler(struct k_timer *timer)
+{
+	struct rv8803_emul_data *data = CONTAINER_OF(timer, struct rv8803_emul_data, timer);
+
+	rv8803_emul_refresh(data);
+}
+
+/* Reference pulse on every second of the kernel clock */
+static void rv8803_emul_pps_handler(struct k_timer *timer)
+{
+	struct rv8803_emul_data *data = CONTAINER_OF(timer, struct rv8803_emul_data, pps_timer);
+	int active = (data->pps_gpio.dt_flags & GPIO_ACTIVE_LOW) ? 0 : 1;
+
+#if CONFIG_GPIO_EMUL
+	gpio_emul_input_set(data->pps_gpio.port, data->pps_gpio.pin, active);
+	gpio_emul_input_set(data->pps_gpio.port, data->pps_gpio.pin, !active);
+#else
+	ARG_UNUSED(active);
+#endif /* CONFIG_GPIO_EMUL */
+}
+
+/* Register access */
+static uint8_t rv8803_emul_read(struct rv8803_emul_data *data, uint8_t reg)
+{
+	return data->regs[rv8803_emul_addr(reg)];
+}
+
+static void rv8803_emul_write(struct rv8803_emul_data *data, uint8_t reg, uint8_t value)
+{
+	uint8_t addr = rv8803_emul_addr(reg);
+	uint8_t *regs = data->regs;
+
+	switch (addr) {
+	case RV8803_EMUL_REGISTER_HUNDREDTHS:
+	case RV8803_EMUL_REGISTER_HUNDREDTHS_CP:
+	case RV8803_EMUL_REGISTER_SECONDS_CP:
+		/* Read only */
+		return;
+
+	case RV8803_REGISTER_FLAG:
+		/* Flags are only cleared by writing 0 */
+		regs[addr] &= value | ~(RV8803_EMUL_FLAG_MASK_IRQ | RV8803_EMUL_FLAG_MASK_POWER);
+		return;
+
+	case RV8803_REGISTER_EXTENSION:
+		/* TE rising edge loads the countdown from the preset registers */
+		if (!(regs[addr] & RV8803_EXTENSION_MASK_COUNTER) &&
+		    (value & RV8803_EXTENSION_MASK_COUNTER)) {
+			data->timer_count = ((regs[RV8803_REGISTER_TIMER_COUNTER_1] & 0x0F) << 8) |
+					    regs[RV8803_REGISTER_TIMER_COUNTER_0];
+			data->timer_acc = 0;
+
+			/* 1 Hz and 1/60 Hz ticks follow the calendar: the first period is short */
+			uint8_t td = value & RV8803_FREQUENCY_MASK_COUNTER;
+			if (td == RV8803_COUNTER_FREQUENCY_1_HZ) {
+				data->timer_acc = data->hundredth_ns +
+						  bcd2bin(regs[RV8803_EMUL_REGISTER_HUNDREDTHS]) *
+							  RV8803_EMUL_HUNDREDTH_NS;
+			} else if (td == RV8803_COUNTER_FREQUENCY_1_60_HZ) {
+				data->timer_acc = data->hundredth_ns +
+						  bcd2bin(regs[RV8803_EMUL_REGISTER_HUNDREDTHS]) *
+							  RV8803_EMUL_HUNDREDTH_NS +
+						  bcd2bin(regs[RV8803_REGISTER_SECONDS] &
+							  RV8803_SECONDS_BITS) * NSEC_PER_SEC;
+			}
+		}
+		break;
+
+	case RV8803_REGISTER_CONTROL:
+		if (value & RV8803_RESET_BIT) {
+			regs[RV8803_EMUL_REGISTER_HUNDREDTHS] = 0;
+			data->hundredth_ns = 0;
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	regs[addr] = value;
+}
+
+static int rv8803_emul_transfer(const struct emul *target, struct i2c_msg *msgs, int num_msgs,
+				int addr)
+{
+	ARG_UNUSED(addr);
+	struct rv8803_emul_data *data = target->data;
+	bool irq = false;
+	int err = 0;
+
+	K_SPINLOCK(&data->lock) {
+		bool start = true;
+
+		rv8803_emul_sync(data);
+		data->stats.transfers++;
+
+		/* Injected error: nothing reaches the registers */
+		if (data->fail_err != 0) {
+			err = data->fail_err;
+			data->fail_err = 0;
+			K_SPINLOCK_BREAK;
+		}
+
+		for (int i = 0; i < num_msgs; i++) {
+			struct i2c_msg *msg = &msgs[i];
+			uint32_t j = 0;
+
+			data->stats.messages++;
+			if (msg->flags & I2C_MSG_RESTART) {
+				start = true;
+			}
+
+			if ((msg->flags & I2C_MSG_RW_MASK) == I2C_MSG_READ) {
+				for (; j < msg->len; j++) {
+					msg->buf[j] = rv8803_emul_read(data, data->pointer);
+					data->pointer = (data->pointer + 1) % RV8803_EMUL_REGISTER_COUNT;
+
+					/* Time goes on while the burst is clocked out */
+					rv8803_emul_advance(data, data->byte_ns);
+					data->last_ns += data->byte_ns;
+				}
+				data->stats.bytes_read += msg->len;
+				continue;
+			}
+
+			/* First byte written after a (re)start is the register pointer */
+			if (start && (msg->len > 0)) {
+				data->pointer = msg->buf[0] % RV8803_EMUL_REGISTER_COUNT;
+				start = false;
+				j = 1;
+			}
+			for (; j < msg->len; j++) {
+				rv8803_emul_write(data, data->pointer, msg->buf[j]);
+				data->pointer = (data->pointer + 1) % RV8803_EMUL_REGISTER_COUNT;
+			}
+			data->stats.bytes_written += msg->len;
+		}
+
+		irq = rv8803_emul_schedule(data);
+	}
+
+	if (err != 0) {
+		return err;
+	}
+	rv8803_emul_set_irq(data, irq);
+
+	return 0;
+}
+
+/* Backdoor */
+uint8_t rv8803_emul_reg_get(const struct emul *target, uint8_t reg)
+{
+	struct rv8803_emul_data *data = target->data;
+	uint8_t value = 0;
+
+	K_SPINLOCK(&data->lock) {
+		rv8803_emul_sync(data);
+		value = rv8803_emul_read(data, reg % RV8803_EMUL_REGISTER_COUNT);
+	}
+
+	return value;
+}
+
+void rv8803_emul_reg_set(const struct emul *target, uint8_t reg, uint8_t value)
+{
+	struct rv8803_emul_data *data = target->data;
+
+	K_SPINLOCK(&data->lock) {
+		rv8803_emul_sync(data);
+		data->regs[rv8803_emul_addr(reg % RV8803_EMUL_REGISTER_COUNT)] = value;
+	}
+
+	rv8803_emul_refresh(data);
+}
+
+void rv8803_emul_byte_time_set(const struct emul *target, uint32_t ns)
+{
+	struct rv8803_emul_data *data = target->data;
+
+	K_SPINLOCK(&data->lock) {
+		data->byte_ns = ns;
+	}
+}
+
+void rv8803_emul_drift_set(const struct emul *target, int32_t ppb)
+{
+	struct rv8803_emul_data *data = target->data;
+
+	K_SPINLOCK(&data->lock) {
+		rv8803_emul_sync(data);
+		data->drift_ppb = ppb;
+	}
+}
+
+void rv8803_emul_evi_trigger(const struct emul *target)
+{
+	struct rv8803_emul_data *data = target->data;
+	uint8_t *regs = data->regs;
+
+	K_SPINLOCK(&data->lock) {
+		rv8803_emul_sync(data);
+
+		/* ECP latches the seconds and 100th of seconds */
+		if (regs[RV8803_REGISTER_EVENT_CONTROL] & RV8803_EVENT_CONTROL_CAPTURE) {
+			regs[RV8803_EMUL_REGISTER_HUNDREDTHS_CP] =
+				regs[RV8803_EMUL_REGISTER_HUNDREDTHS];
+			regs[RV8803_EMUL_REGISTER_SECONDS_CP] = regs[RV8803_REGISTER_SECONDS];
+		}
+		regs[RV8803_REGISTER_FLAG] |= RV8803_FLAG_MASK_EVENT;
+	}
+
+	rv8803_emul_refresh(data);
+}
+
+void rv8803_emul_pps_set(const struct emul *target, const struct gpio_dt_spec *pps)
+{
+	struct rv8803_emul_data *data = target->data;
+	int64_t now = k_uptime_ticks();
+	int64_t second = k_sec_to_ticks_ceil64(1);
+
+	k_timer_stop(&data->pps_timer);
+	if (pps == NULL) {
+		return;
+	}
+
+	data->pps_gpio = *pps;
+	k_timer_start(&data->pps_timer, K_TICKS(second - (now % second)), K_SECONDS(1));
+}
+
+void rv8803_emul_fail_next(const struct emul *target, int err)
+{
+	struct rv8803_emul_data *data = target->data;
+
+	K_SPINLOCK(&data->lock) {
+		data->fail_err = err;
+	}
+}
+
+void rv8803_emul_stats_get(const struct emul *target, struct rv8803_emul_stats *stats)
+{
+	struct rv8803_emul_data *data = target->data;
+
+	K_SPINLOCK(&data->lock) {
+		*stats = data->stats;
+	}
+}
+
+void rv8803_emul_stats_reset(const struct emul *target)
+{
+	struct rv8803_emul_data *data = target->data;
+
+	K_SPINLOCK(&data->lock) {
+		memset(&data->stats, 0, sizeof(data->stats));
+	}
+}
+
+/* RV8803 emulator init */
+static int rv8803_emul_init(const struct emul *target, const struct device *parent)
+{
+	ARG_UNUSED(parent);
+	struct rv8803_emul_data *data = target->data;
+	const struct rv8803_emul_cfg *cfg = target->cfg;
+
+	/* Power-on state: 01/01/2000, both voltage flags raised */
+	memset(data->regs, 0, sizeof(data->regs));
+	data->regs[RV8803_REGISTER_WEEKDAY] = 0x01;
+	data->regs[RV8803_REGISTER_DATE] = 0x01;
+	data->regs[RV8803_REGISTER_MONTH] = 0x01;
+	data->regs[RV8803_REGISTER_FLAG] = RV8803_EMUL_FLAG_MASK_POWER;
+
+	data->target = target;
+	data->last_ns = rv8803_emul_now_ns();
+	k_timer_init(&data->timer, rv8803_emul_timer_handler, NULL);
+	k_timer_init(&data->pps_timer, rv8803_emul_pps_handler, NULL);
+
+	data->irq_asserted = true;
+	if ((cfg->irq_gpio.port != NULL) && device_is_ready(cfg->irq_gpio.port)) {
+		rv8803_emul_set_irq(data, false);
+	}
+
+	LOG_INF("RV8803 EMUL INIT");
+
+	return 0;
+}
+
+static const struct i2c_emul_api rv8803_emul_api_i2c = {
+	.transfer = rv8803_emul_transfer,
+};
+
+/* RV8803 emulator Initialization MACRO */
+#define RV8803_EMUL(n)                                                                             \
+	static const struct rv8803_emul_cfg rv8803_emul_cfg_##n = {                                \
+		.irq_gpio = GPIO_DT_SPEC_INST_GET_OR(n, irq_gpios, {0}),                           \
+	};                                                                                         \
+	static struct rv8803_emul_data rv8803_emul_data_##n;                                       \
+	EMUL_DT_INST_DEFINE(n, rv8803_emul_init, &rv8803_emul_data_##n, &rv8803_emul_cfg_##n,      \
+			    &rv8803_emul_api_i2c, NULL);
+
+/* Instanciate RV8803 emulator */
+DT_INST_FOREACH_STATUS_OKAY(RV8803_EMUL)
+#undef DT_DRV_COMPAT
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_DRIVERS_RTC_RV8803_EMUL_H_
+#define ZEPHYR_DRIVERS_RTC_RV8803_EMUL_H_
+
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/gpio.h>
+
+/* Emulated register map: 0x00 - 0x2F */
+#define RV8803_EMUL_REGISTER_COUNT 0x30
+
+/* Bus traffic seen by the emulator */
+struct rv8803_emul_stats {
+	uint32_t transfers;
+	uint32_t messages;
+	uint32_t bytes_read;
+	uint32_t bytes_written;
+	uint32_t timer_events; /* TF raised by the countdown timer */
+};
+
+/* Backdoor access, bypassing bus statistics */
+uint8_t rv8803_emul_reg_get(const struct emul *target, uint8_t reg);
+void rv8803_emul_reg_set(const struct emul *target, uint8_t reg, uint8_t value);
+
+/* Time elapsing on the emulated clock per byte read, 0 by default */
+void rv8803_emul_byte_time_set(const struct emul *target, uint32_t ns);
+
+/* Oscillator error (ppb, positive is fast), on top of which the OFFSET register applies */
+void rv8803_emul_drift_set(const struct emul *target, int32_t ppb);
+
+/* Active edge on EVI, after the devicetree filter */
+void rv8803_emul_evi_trigger(const struct emul *target);
+
+/* Ideal reference: one pulse per second of the kernel clock on a GPIO emulator pin, NULL stops */
+void rv8803_emul_pps_set(const struct emul *target, const struct gpio_dt_spec *pps);
+
+/* The next transfer fails with err (negative) and leaves the registers untouched, 0 cancels */
+void rv8803_emul_fail_next(const struct emul *target, int err);
+
+void rv8803_emul_stats_get(const struct emul *target, struct rv8803_emul_stats *stats);
+void rv8803_emul_stats_reset(const struct emul *target);
+
+#endif /* ZEPHYR_DRIVERS_RTC_RV8803_EMUL_H_ */
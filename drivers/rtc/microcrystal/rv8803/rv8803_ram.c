@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT microcrystal_rv8803_ram_catie
+
+#include <zephyr/drivers/retained_mem.h>
+#include <zephyr/logging/log.h>
+
+#include "rv8803.h"
+#include "rv8803_ram.h"
+
+LOG_MODULE_REGISTER(RV8803_RAM, CONFIG_RTC_LOG_LEVEL);
+
+#if CONFIG_RETAINED_MEM && CONFIG_RV8803_RAM_ENABLE
+static ssize_t rv8803_ram_size(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return RV8803_RAM_SIZE;
+}
+
+static int rv8803_ram_read(const struct device *dev, off_t offset, uint8_t *buffer, size_t size)
+{
+	const struct rv8803_ram_config *ram_config = dev->config;
+	struct rv8803_ram_data *ram_data = dev->data;
+	enum rv8803_bus_caller caller;
+	int err = 0;
+
+	/* Bounds are checked by the retained_mem API: offset 0, size 1 */
+	ARG_UNUSED(offset);
+	ARG_UNUSED(size);
+
+	/* Only this device writes the register: read once, then served from RAM */
+	caller = rv8803_bus_lock(ram_config->base_dev, RV8803_BUS_CALLER_RAM);
+	if (!ram_data->loaded) {
+		err = rv8803_bus_reg_read(ram_config->base_dev, RV8803_REGISTER_RAM,
+					  &ram_data->value);
+		ram_data->loaded = (err == 0);
+	}
+	if (err == 0) {
+		buffer[0] = ram_data->value;
+	}
+	rv8803_bus_unlock(ram_config->base_dev, caller);
+
+	return err;
+}
+
+static int rv8803_ram_write(const struct device *dev, off_t offset, const uint8_t *buffer,
+			    size_t size)
+{
+	const struct rv8803_ram_config *ram_config = dev->config;
+	struct rv8803_ram_data *ram_data = dev->data;
+	enum rv8803_bus_caller caller;
+	int err = 0;
+
+	/* Bounds are checked by the retained_mem API: offset 0, size 1 */
+	ARG_UNUSED(offset);
+	ARG_UNUSED(size);
+
+	/* Single byte: the write is skipped when the value does not change */
+	caller = rv8803_bus_lock(ram_config->base_dev, RV8803_BUS_CALLER_RAM);
+	if (!ram_data->loaded || (ram_data->value != buffer[0])) {
+		err = rv8803_bus_reg_write(ram_config->base_dev, RV8803_REGISTER_RAM,
+					   buffer[0]);
+		ram_data->loaded = (err == 0);
+		ram_data->value = buffer[0];
+	}
+	rv8803_bus_unlock(ram_config->base_dev, caller);
+	if (err < 0) {
+		LOG_ERR("Write RAM: [%d]", err);
+	}
+
+	return err;
+}
+
+static int rv8803_ram_clear(const struct device *dev)
+{
+	const uint8_t zero = 0;
+
+	return rv8803_ram_write(dev, 0, &zero, sizeof(zero));
+}
+
+/* RV8803 RAM init */
+static int rv8803_ram_init(const struct device *dev)
+{
+	const struct rv8803_ram_config *config = dev->config;
+
+	if (!device_is_ready(config->base_dev)) {
+		return -ENODEV;
+	}
+	LOG_INF("RV8803 RAM INIT");
+
+	return 0;
+}
+
+/* RV8803 RAM driver API */
+static const struct retained_mem_driver_api rv8803_ram_driver_api = {
+	.size = rv8803_ram_size,
+	.read = rv8803_ram_read,
+	.write = rv8803_ram_write,
+	.clear = rv8803_ram_clear,
+};
+
+/* RV8803 RAM Initialization MACRO */
+#define RV8803_RAM_INIT(n)                                                                         \
+	static const struct rv8803_ram_config rv8803_ram_config_##n = {                            \
+		.base_dev = DEVICE_DT_GET(DT_PARENT(DT_INST(n, DT_DRV_COMPAT))),                   \
+	};                                                                                         \
+	static struct rv8803_ram_data rv8803_ram_data_##n;                                         \
+	DEVICE_DT_INST_DEFINE(n, rv8803_ram_init, NULL, &rv8803_ram_data_##n,                      \
+			      &rv8803_ram_config_##n, POST_KERNEL, CONFIG_RTC_INIT_PRIORITY,       \
+			      &rv8803_ram_driver_api);
+
+/* Instanciate RV8803 RAM */
+DT_INST_FOREACH_STATUS_OKAY(RV8803_RAM_INIT)
+#endif /* CONFIG_RETAINED_MEM && CONFIG_RV8803_RAM_ENABLE */
+#undef DT_DRV_COMPAT
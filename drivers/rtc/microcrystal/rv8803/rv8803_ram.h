@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_DRIVERS_RTC_RV8803_RAM_H_
+#define ZEPHYR_DRIVERS_RTC_RV8803_RAM_H_
+
+/* User RAM register, kept on backup supply */
+#define RV8803_REGISTER_RAM 0x07
+#define RV8803_RAM_SIZE     1
+
+/* Structs */
+#if CONFIG_RETAINED_MEM && CONFIG_RV8803_RAM_ENABLE
+/* RV8803 RAM config */
+struct rv8803_ram_config {
+	const struct device *base_dev; /* Parent device reference */
+};
+
+/* RV8803 RAM data */
+struct rv8803_ram_data {
+	bool loaded; /* value mirrors the register */
+	uint8_t value;
+};
+#endif
+#endif /* ZEPHYR_DRIVERS_RTC_RV8803_RAM_H_ */
@@ -5,20 +5,256 @@
 
 #define DT_DRV_COMPAT microcrystal_rv8803_rtc_catie
 
+#include <stdlib.h>
+#include <string.h>
 #include <zephyr/drivers/rtc.h>
 #include <zephyr/sys/util.h>
+#include <zephyr/sys/timeutil.h>
 #include <zephyr/logging/log.h>
 
 #include "rv8803.h"
 #include "rv8803_rtc.h"
+#if CONFIG_RV8803_RTC_ALARM_SECONDS
+#include "rv8803_cnt.h"
+#endif /* CONFIG_RV8803_RTC_ALARM_SECONDS */
 #include <math.h>
 
 LOG_MODULE_REGISTER(RV8803_RTC, CONFIG_RTC_LOG_LEVEL);
 
 #if CONFIG_RTC && CONFIG_RV8803_RTC_ENABLE
+#if CONFIG_RV8803_RTC_DISCIPLINE
+#if !RV8803_IRQ_GPIO_USE_UPDATE
+#error "CONFIG_RV8803_RTC_DISCIPLINE needs the update interrupt: irq-gpios and CONFIG_RTC_UPDATE"
+#endif /* !RV8803_IRQ_GPIO_USE_UPDATE */
+static void rv8803_rtc_discipline_invalidate(const struct device *dev);
+static void rv8803_rtc_discipline_offset_set(const struct device *dev, uint8_t offset);
+static bool rv8803_rtc_discipline_edge(const struct device *dev, const struct rv8803_event *event);
+#endif /* CONFIG_RV8803_RTC_DISCIPLINE */
+#if CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS
+#if !RV8803_IRQ_GPIO_USE_UPDATE
+#error "CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS needs the update interrupt: irq-gpios"
+#endif /* !RV8803_IRQ_GPIO_USE_UPDATE */
+static void rv8803_rtc_update_notify(const struct device *dev, const struct rv8803_event *event);
+#endif /* CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS */
+#if RV8803_IRQ_GPIO_USE_ALARM
+static int rv8803_rtc_alarm_reschedule(const struct device *dev, int64_t now);
+static uint32_t rv8803_rtc_alarm_expire(const struct device *dev, const uint8_t *calendar);
+static void rv8803_rtc_alarm_notify(const struct device *dev, uint32_t due);
+#endif /* RV8803_IRQ_GPIO_USE_ALARM */
+#if CONFIG_RV8803_RTC_EVI && !RV8803_IRQ_GPIO_USE_EVI
+#error "CONFIG_RV8803_RTC_EVI needs irq-gpios"
+#endif /* CONFIG_RV8803_RTC_EVI && !RV8803_IRQ_GPIO_USE_EVI */
+
+static void rv8803_rtc_encode(const struct rtc_time *timeptr, uint8_t *regs)
+{
+	regs[0] = bin2bcd(timeptr->tm_sec) & RV8803_SECONDS_BITS;
+	regs[1] = bin2bcd(timeptr->tm_min) & RV8803_MINUTES_BITS;
+	regs[2] = bin2bcd(timeptr->tm_hour) & RV8803_HOURS_BITS;
+	regs[3] = (1 << timeptr->tm_wday) & RV8803_WEEKDAY_BITS;
+	regs[4] = bin2bcd(timeptr->tm_mday) & RV8803_DATE_BITS;
+	regs[5] = bin2bcd(timeptr->tm_mon + RV8803_TM_MONTH) & RV8803_MONTH_BITS;
+	regs[6] = bin2bcd(timeptr->tm_year - RV8803_CORRECT_YEAR_LEAP_MIN) & RV8803_YEAR_BITS;
+}
+
+static void rv8803_rtc_decode(const uint8_t *regs, struct rtc_time *timeptr)
+{
+	timeptr->tm_sec = bcd2bin(regs[0] & RV8803_SECONDS_BITS);
+	timeptr->tm_min = bcd2bin(regs[1] & RV8803_MINUTES_BITS);
+	timeptr->tm_hour = bcd2bin(regs[2] & RV8803_HOURS_BITS);
+	timeptr->tm_wday = log2(regs[3] & RV8803_WEEKDAY_BITS);
+	timeptr->tm_mday = bcd2bin(regs[4] & RV8803_DATE_BITS);
+	timeptr->tm_mon = bcd2bin(regs[5] & RV8803_MONTH_BITS) - RV8803_TM_MONTH;
+	timeptr->tm_year = bcd2bin(regs[6] & RV8803_YEAR_BITS) + RV8803_CORRECT_YEAR_LEAP_MIN;
+
+	/* Unused */
+	timeptr->tm_nsec = 0;
+	timeptr->tm_isdst = -1;
+	timeptr->tm_yday = -1;
+}
+
+/*
+ * Tear-free time from the 100th of seconds and the calendar mirror (0x10 - 0x17). Below 99, the
+ * next second is at least 10 ms away, far more than the 7 calendar bytes take on the bus: the copy
+ * is whole. At 99, the second may roll over during the burst and the window is read again: still
+ * 99, the first copy was read before the increment; anything else, the second copy is whole. ticks
+ * is the kernel time of the read.
+ */
+static int rv8803_rtc_read(const struct device *dev, uint8_t *calendar, uint8_t *hundredths,
+			   int64_t *ticks)
+{
+	const struct rv8803_rtc_config *rtc_config = dev->config;
+	uint8_t regs[2][RV8803_TIME_READ_SIZE];
+	int64_t start[2];
+	int i;
+	int err;
+
+	for (i = 0; i < ARRAY_SIZE(regs); i++) {
+		start[i] = k_uptime_ticks();
+		err = rv8803_bus_burst_read(rtc_config->base_dev, RV8803_REGISTER_HUNDREDTHS,
+					    regs[i], sizeof(regs[i]));
+		if (err < 0) {
+			return err;
+		}
+		if (bcd2bin(regs[i][0]) != 99) {
+			break;
+		}
+	}
+
+	/* 99 twice: the second boundary comes after both bursts */
+	if (i == ARRAY_SIZE(regs)) {
+		i = 0;
+	}
+
+	*ticks = start[i];
+	*hundredths = bcd2bin(regs[i][0]);
+	memcpy(calendar, &regs[i][RV8803_REGISTER_CALENDAR_MIRROR - RV8803_REGISTER_HUNDREDTHS],
+	       RV8803_CALENDAR_SIZE);
+
+	return 0;
+}
+
+#if CONFIG_RV8803_RTC_TIME_CACHE
+/* Anchor: regs is the calendar whose second started at ticks */
+static void rv8803_rtc_anchor_set(const struct device *dev, const uint8_t *regs, int64_t ticks)
+{
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_anchor *anchor = rtc_data->rtc_anchor;
+	struct rtc_time time;
+	k_spinlock_key_t key;
+	int64_t second;
+
+	rv8803_rtc_decode(regs, &time);
+	second = timeutil_timegm64(rtc_time_to_tm(&time));
+
+	key = k_spin_lock(&anchor->lock);
+	anchor->ticks = ticks;
+	anchor->second = second;
+	anchor->valid = true;
+	k_spin_unlock(&anchor->lock, key);
+}
+
+static void rv8803_rtc_anchor_invalidate(const struct device *dev)
+{
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_anchor *anchor = rtc_data->rtc_anchor;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&anchor->lock);
+	anchor->valid = false;
+	anchor->served_ns = 0;
+	k_spin_unlock(&anchor->lock, key);
+}
+
+/* Time from RAM, -EAGAIN when the anchor is missing or too old */
+static int rv8803_rtc_anchor_get(const struct device *dev, struct rtc_time *timeptr)
+{
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_anchor *anchor = rtc_data->rtc_anchor;
+	int64_t now = k_uptime_ticks();
+	k_spinlock_key_t key;
+	time_t second;
+	int64_t ns;
+
+	key = k_spin_lock(&anchor->lock);
+	if (!anchor->valid ||
+	    ((now - anchor->ticks) > k_ms_to_ticks_ceil64(CONFIG_RV8803_RTC_TIME_CACHE_MAX_AGE_MS))) {
+		k_spin_unlock(&anchor->lock, key);
+		return -EAGAIN;
+	}
+
+	ns = (anchor->second * NSEC_PER_SEC) + k_ticks_to_ns_floor64(now - anchor->ticks);
+	ns = MAX(ns, anchor->served_ns);
+	anchor->served_ns = ns;
+	k_spin_unlock(&anchor->lock, key);
+
+	second = ns / NSEC_PER_SEC;
+	gmtime_r(&second, rtc_time_to_tm(timeptr));
+	timeptr->tm_nsec = ns % NSEC_PER_SEC;
+	timeptr->tm_isdst = -1;
+	timeptr->tm_yday = -1;
+
+	return 0;
+}
+
+/* Anchor from the bus: the 100th of seconds give the start of the current second */
+static int rv8803_rtc_anchor_refresh(const struct device *dev)
+{
+	uint8_t calendar[RV8803_CALENDAR_SIZE];
+	uint8_t hundredths;
+	int64_t ticks;
+	int err;
+
+	err = rv8803_rtc_read(dev, calendar, &hundredths, &ticks);
+	if (err < 0) {
+		return err;
+	}
+
+	ticks -= k_ms_to_ticks_floor64(hundredths * RV8803_HUNDREDTHS_MS);
+	rv8803_rtc_anchor_set(dev, calendar, ticks);
+
+	return 0;
+}
+#endif /* CONFIG_RV8803_RTC_TIME_CACHE */
+
+/* Called with the bus locked: releases RESET, then the written second (if any) starts now */
+static int rv8803_rtc_time_start(const struct device *dev, const uint8_t *regs)
+{
+	const struct rv8803_rtc_config *rtc_config = dev->config;
+	int err;
+
+	/* Restart time update clock, no-op when already done */
+	err = rv8803_bus_reg_update(rtc_config->base_dev, RV8803_REGISTER_CONTROL,
+				    RV8803_RESET_BIT, 0);
+	if ((err < 0) || (regs == NULL)) {
+		return err;
+	}
+
+#if CONFIG_RV8803_RTC_TIME_CACHE
+	rv8803_rtc_anchor_set(dev, regs, k_uptime_ticks());
+#endif /* CONFIG_RV8803_RTC_TIME_CACHE */
+#if RV8803_IRQ_GPIO_USE_ALARM
+	/* Occurrences skipped or repeated by the new time are not notified */
+	struct rtc_time written;
+
+	rv8803_rtc_decode(regs, &written);
+	err = rv8803_rtc_alarm_reschedule(dev, timeutil_timegm64(rtc_time_to_tm(&written)));
+#endif /* RV8803_IRQ_GPIO_USE_ALARM */
+
+	return err;
+}
+
+#if CONFIG_RV8803_RTC_SET_TIME_ALIGN
+static void rv8803_rtc_align_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct rv8803_rtc_align *align = CONTAINER_OF(dwork, struct rv8803_rtc_align, work);
+	const struct rv8803_rtc_config *rtc_config = align->dev->config;
+	enum rv8803_bus_caller caller;
+	int64_t remaining;
+	int err = 0;
+
+	caller = rv8803_bus_lock(rtc_config->base_dev, RV8803_BUS_CALLER_SET_TIME);
+	remaining = align->release - k_uptime_ticks();
+
+	/* Superseded by another rtc_set_time() while waiting for the bus */
+	if (align->pending && (remaining > 0)) {
+		k_work_reschedule(&align->work, K_TICKS(remaining));
+	} else if (align->pending) {
+		align->pending = false;
+		err = rv8803_rtc_time_start(align->dev, align->regs);
+	}
+	rv8803_bus_unlock(rtc_config->base_dev, caller);
+	if (err < 0) {
+		LOG_ERR("Release RESET: [%d]", err);
+	}
+}
+#endif /* CONFIG_RV8803_RTC_SET_TIME_ALIGN */
+
 /* API */
 static int rv8803_rtc_set_time(const struct device *dev, const struct rtc_time *timeptr)
 {
+	int64_t start = k_uptime_ticks();
+
 	/* Valid date are between 2000 and 2099 */
 	if ((timeptr == NULL) || (timeptr->tm_year < RV8803_CORRECT_YEAR_LEAP_MIN) ||
 	    (timeptr->tm_year > RV8803_CORRECT_YEAR_LEAP_MAX)) {
@@ -32,454 +268,1374 @@ static int rv8803_rtc_set_time(const struct device *dev, const struct rtc_time *
 
 	/* Init variables for i2c communication */
 	const struct rv8803_rtc_config *rtc_config = dev->config;
-	const struct rv8803_config *config = rtc_config->base_dev->config;
+	struct rv8803_bus_plan plan;
+	enum rv8803_bus_caller caller;
+	int64_t release = 0;
 	uint8_t regs[7];
-	uint8_t control_reg[1];
 	int err;
 
-	regs[0] = bin2bcd(timeptr->tm_sec) & RV8803_SECONDS_BITS;
-	regs[1] = bin2bcd(timeptr->tm_min) & RV8803_MINUTES_BITS;
-	regs[2] = bin2bcd(timeptr->tm_hour) & RV8803_HOURS_BITS;
-	regs[3] = (1 << timeptr->tm_wday) & RV8803_WEEKDAY_BITS;
-	regs[4] = bin2bcd(timeptr->tm_mday) & RV8803_DATE_BITS;
-	regs[5] = bin2bcd(timeptr->tm_mon + RV8803_TM_MONTH) & RV8803_MONTH_BITS;
-	regs[6] = bin2bcd(timeptr->tm_year - RV8803_CORRECT_YEAR_LEAP_MIN) & RV8803_YEAR_BITS;
+#if CONFIG_RV8803_RTC_SET_TIME_ALIGN
+	/*
+	 * The divider restarts when RESET is released: write the next second and release RESET
+	 * when it starts, counted from the call.
+	 */
+	if ((timeptr->tm_nsec < 0) || (timeptr->tm_nsec >= NSEC_PER_SEC)) {
+		LOG_ERR("invalid time");
+		return -EINVAL;
+	} else if (timeptr->tm_nsec != 0) {
+		struct rtc_time next;
+		time_t second = timeutil_timegm64(rtc_time_to_tm((struct rtc_time *)timeptr)) + 1;
+
+		gmtime_r(&second, rtc_time_to_tm(&next));
+		if (next.tm_year > RV8803_CORRECT_YEAR_LEAP_MAX) {
+			return -EINVAL;
+		}
+		rv8803_rtc_encode(&next, regs);
+		release = start + k_ns_to_ticks_ceil64(NSEC_PER_SEC - timeptr->tm_nsec);
+	} else {
+		rv8803_rtc_encode(timeptr, regs);
+	}
+#else
+	ARG_UNUSED(start);
+	rv8803_rtc_encode(timeptr, regs);
+#endif /* CONFIG_RV8803_RTC_SET_TIME_ALIGN */
+
+	caller = rv8803_bus_lock(rtc_config->base_dev, RV8803_BUS_CALLER_SET_TIME);
+#if CONFIG_RV8803_RTC_SET_TIME_ALIGN
+	/* A release still pending is superseded */
+	struct rv8803_rtc_align *align = ((struct rv8803_rtc_data *)dev->data)->rtc_align;
+
+	align->pending = false;
+#endif /* CONFIG_RV8803_RTC_SET_TIME_ALIGN */
+#if CONFIG_RV8803_RTC_TIME_CACHE
+	rv8803_rtc_anchor_invalidate(dev);
+#endif /* CONFIG_RV8803_RTC_TIME_CACHE */
+#if CONFIG_RV8803_RTC_DISCIPLINE
+	rv8803_rtc_discipline_invalidate(dev);
+#endif /* CONFIG_RV8803_RTC_DISCIPLINE */
+
+	/* Stop time update clock, write new time and restart it in one transaction */
+	rv8803_bus_plan_init(&plan);
+	err = rv8803_bus_plan_update(rtc_config->base_dev, &plan, RV8803_REGISTER_CONTROL,
+				     RV8803_RESET_BIT, RV8803_RESET_BIT);
+	rv8803_bus_plan_write(&plan, RV8803_REGISTER_SECONDS, regs, sizeof(regs));
+	if ((err == 0) && (release == 0)) {
+		err = rv8803_bus_plan_update(rtc_config->base_dev, &plan, RV8803_REGISTER_CONTROL,
+					     RV8803_RESET_BIT, 0);
+	}
+	if (err == 0) {
+		err = rv8803_bus_plan_commit(rtc_config->base_dev, &plan);
+	}
+	if (err < 0) {
+		LOG_ERR("Write TIME: [%d]", err);
+	}
+
+	int ret = 0;
+
+#if CONFIG_RV8803_RTC_SET_TIME_ALIGN
+	/* Hold the divider in reset until the written second starts, without blocking the bus */
+	if ((err == 0) && (release != 0)) {
+		memcpy(align->regs, regs, sizeof(align->regs));
+		align->release = release;
+		align->pending = true;
+		k_work_reschedule(&align->work, K_TICKS(MAX(release - k_uptime_ticks(), 0)));
+	}
+#endif /* CONFIG_RV8803_RTC_SET_TIME_ALIGN */
+	if ((err < 0) || (release == 0)) {
+		ret = rv8803_rtc_time_start(dev, (err == 0) ? regs : NULL);
+	}
+	rv8803_bus_unlock(rtc_config->base_dev, caller);
+
+	return (err < 0) ? err : ret;
+}
+
+static int rv8803_rtc_get_time(const struct device *dev, struct rtc_time *timeptr)
+{
+	if (timeptr == NULL) {
+		return -EINVAL;
+	}
+
+	/* Init variables for i2c communication */
+	const struct rv8803_rtc_config *rtc_config = dev->config;
+	enum rv8803_bus_caller caller;
+	int err;
+
+#if CONFIG_RV8803_RTC_TIME_CACHE
+	err = rv8803_rtc_anchor_get(dev, timeptr);
+	if (err != -EAGAIN) {
+		return err;
+	}
+
+	caller = rv8803_bus_lock(rtc_config->base_dev, RV8803_BUS_CALLER_GET_TIME);
+	err = rv8803_rtc_anchor_refresh(dev);
+	rv8803_bus_unlock(rtc_config->base_dev, caller);
+	if (err < 0) {
+		return err;
+	}
+
+	return rv8803_rtc_anchor_get(dev, timeptr);
+#else
+	uint8_t calendar[RV8803_CALENDAR_SIZE];
+	uint8_t hundredths;
+	int64_t ticks;
 
-	/* Stopping time update clock */
-	err = i2c_burst_read_dt(&config->i2c_bus, RV8803_REGISTER_CONTROL, control_reg,
-				sizeof(control_reg));
+	caller = rv8803_bus_lock(rtc_config->base_dev, RV8803_BUS_CALLER_GET_TIME);
+	err = rv8803_rtc_read(dev, calendar, &hundredths, &ticks);
+	rv8803_bus_unlock(rtc_config->base_dev, caller);
 	if (err < 0) {
 		return err;
 	}
-	control_reg[0] |= RV8803_RESET_BIT;
-	err = i2c_burst_write_dt(&config->i2c_bus, RV8803_REGISTER_CONTROL, control_reg,
-				 sizeof(control_reg));
+
+	rv8803_rtc_decode(calendar, timeptr);
+	timeptr->tm_nsec = hundredths * RV8803_HUNDREDTHS_MS * NSEC_PER_MSEC;
+
+	LOG_DBG("Get time: year[%u] month[%u] mday[%u] wday[%u] hours[%u] minutes[%u] seconds[%u]",
+		timeptr->tm_year, timeptr->tm_mon, timeptr->tm_mday, timeptr->tm_wday,
+		timeptr->tm_hour, timeptr->tm_min, timeptr->tm_sec);
+	return 0;
+#endif /* CONFIG_RV8803_RTC_TIME_CACHE */
+}
+
+#if RV8803_IRQ_GPIO_USE_EVI
+/*
+ * Only seconds and 100th of seconds are captured: the rest comes from the calendar read by the
+ * interrupt worker after the event, one minute back when the captured second is ahead of it.
+ */
+static void rv8803_rtc_evi_capture(const struct device *dev, const struct rv8803_event *event)
+{
+	const struct rv8803_rtc_config *rtc_config = dev->config;
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_evi *evi = rtc_data->rtc_evi;
+	enum rv8803_bus_caller caller;
+	struct rtc_time *timeptr;
+	struct rtc_time now;
+	uint8_t regs[2];
+	uint32_t head;
+	time_t second;
+	int captured;
+	int err;
+
+	caller = rv8803_bus_lock(rtc_config->base_dev, RV8803_BUS_CALLER_IRQ);
+	err = rv8803_bus_burst_read(rtc_config->base_dev, RV8803_REGISTER_HUNDREDTHS_CP, regs,
+				    sizeof(regs));
+	rv8803_bus_unlock(rtc_config->base_dev, caller);
+	if (err < 0) {
+		LOG_ERR("Read EVI capture: [%d]", err);
+		return;
+	}
+
+	/* Unsigned indices: the difference and the modulo hold once the counts wrap */
+	head = (uint32_t)atomic_get(&evi->head);
+	if ((head - (uint32_t)atomic_get(&evi->tail)) >= CONFIG_RV8803_RTC_EVI_BUFFER_SIZE) {
+		atomic_inc(&evi->dropped);
+		return;
+	}
+
+	rv8803_rtc_decode(event->time, &now);
+	captured = bcd2bin(regs[1] & RV8803_SECONDS_BITS);
+	second = timeutil_timegm64(rtc_time_to_tm(&now));
+	second -= (now.tm_sec - captured + 60) % 60;
+
+	/* Slot is published by the head increment */
+	timeptr = &evi->buf[head % CONFIG_RV8803_RTC_EVI_BUFFER_SIZE];
+	gmtime_r(&second, rtc_time_to_tm(timeptr));
+	timeptr->tm_nsec = bcd2bin(regs[0]) * RV8803_HUNDREDTHS_MS * NSEC_PER_MSEC;
+	timeptr->tm_isdst = -1;
+	timeptr->tm_yday = -1;
+	atomic_set(&evi->head, (atomic_val_t)(head + 1));
+}
+
+int rv8803_rtc_evi_enable(const struct device *dev, rv8803_rtc_evi_callback callback,
+			  void *user_data)
+{
+	const struct rv8803_rtc_config *rtc_config = dev->config;
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_evi *evi = rtc_data->rtc_evi;
+	uint8_t control = rtc_config->evi_control | RV8803_EVENT_CONTROL_CAPTURE;
+	struct rv8803_bus_plan plan;
+	enum rv8803_bus_caller caller;
+	int err;
+
+	caller = rv8803_bus_lock(rtc_config->base_dev, RV8803_BUS_CALLER_OTHER);
+	evi->evi_cb = callback;
+	evi->evi_cb_data = user_data;
+	evi->enabled = true;
+
+	/* Edge, filter and capture, then EVF to 0 and EIE to 1 (0x0E - 0x0F) */
+	rv8803_bus_plan_init(&plan);
+	rv8803_bus_plan_write(&plan, RV8803_REGISTER_EVENT_CONTROL, &control, 1);
+	rv8803_bus_plan_flag_clear(&plan, RV8803_FLAG_MASK_EVENT);
+	err = rv8803_bus_plan_update(rtc_config->base_dev, &plan, RV8803_REGISTER_CONTROL,
+				     RV8803_CONTROL_MASK_EVENT, RV8803_ENABLE_EVENT);
+	if (err == 0) {
+		err = rv8803_bus_plan_commit(rtc_config->base_dev, &plan);
+	}
+	if (err < 0) {
+		LOG_ERR("Write EVI: [%d]", err);
+		evi->enabled = false;
+	}
+	rv8803_bus_unlock(rtc_config->base_dev, caller);
+
+	return err;
+}
+
+int rv8803_rtc_evi_disable(const struct device *dev)
+{
+	const struct rv8803_rtc_config *rtc_config = dev->config;
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_evi *evi = rtc_data->rtc_evi;
+	uint8_t control = rtc_config->evi_control;
+	struct rv8803_bus_plan plan;
+	enum rv8803_bus_caller caller;
+	int err;
+
+	/* EIE to 0, then capture off: timestamps already buffered stay readable */
+	caller = rv8803_bus_lock(rtc_config->base_dev, RV8803_BUS_CALLER_OTHER);
+	evi->enabled = false;
+	rv8803_bus_plan_init(&plan);
+	err = rv8803_bus_plan_update(rtc_config->base_dev, &plan, RV8803_REGISTER_CONTROL,
+				     RV8803_CONTROL_MASK_EVENT, RV8803_DISABLE_EVENT);
+	rv8803_bus_plan_write(&plan, RV8803_REGISTER_EVENT_CONTROL, &control, 1);
+	if (err == 0) {
+		err = rv8803_bus_plan_commit(rtc_config->base_dev, &plan);
+	}
+	rv8803_bus_unlock(rtc_config->base_dev, caller);
+
+	return err;
+}
+
+int rv8803_rtc_evi_read(const struct device *dev, struct rtc_time *timeptr)
+{
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_evi *evi = rtc_data->rtc_evi;
+	uint32_t tail = (uint32_t)atomic_get(&evi->tail);
+
+	if (timeptr == NULL) {
+		return -EINVAL;
+	}
+	if (tail == (uint32_t)atomic_get(&evi->head)) {
+		return -EAGAIN;
+	}
+
+	*timeptr = evi->buf[tail % CONFIG_RV8803_RTC_EVI_BUFFER_SIZE];
+	atomic_set(&evi->tail, (atomic_val_t)(tail + 1));
+
+	return 0;
+}
+
+uint32_t rv8803_rtc_evi_dropped(const struct device *dev)
+{
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+
+	return atomic_get(&rtc_data->rtc_evi->dropped);
+}
+#endif /* RV8803_IRQ_GPIO_USE_EVI */
+
+#if RV8803_IRQ_GPIO_IN_USE
+static uint8_t rv8803_rtc_irq_handler(const struct device *dev, const struct rv8803_event *event)
+{
+	const struct rv8803_rtc_config *rtc_config = dev->config;
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	uint8_t handled = 0;
+
+	LOG_DBG("Process RTC event from interrupt");
+
+#if RV8803_IRQ_GPIO_USE_ALARM
+	if (event->flag & RV8803_ALARM_FLAG_MASK) {
+		enum rv8803_bus_caller caller;
+		uint32_t due;
+
+		/* The nearest virtual alarm is re-armed before the callbacks run */
+		caller = rv8803_bus_lock(rtc_config->base_dev, RV8803_BUS_CALLER_ALARM);
+		due = rv8803_rtc_alarm_expire(dev, event->time);
+		rv8803_bus_unlock(rtc_config->base_dev, caller);
+		rv8803_rtc_alarm_notify(dev, due);
+		rv8803_latency_record(rtc_config->base_dev, RV8803_EVENT_ALARM, event);
+		handled |= RV8803_ALARM_FLAG_MASK;
+	}
+#endif
+
+#if RV8803_IRQ_GPIO_USE_UPDATE
+	if (event->flag & RV8803_FLAG_MASK_UPDATE) {
+#if CONFIG_RV8803_RTC_DISCIPLINE
+		if (rv8803_rtc_discipline_edge(dev, event)) {
+			handled |= RV8803_FLAG_MASK_UPDATE;
+		}
+#endif /* CONFIG_RV8803_RTC_DISCIPLINE */
+		bool notify = (rtc_data->rtc_update->update_cb != NULL);
+#if CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS
+		notify = notify || !sys_slist_is_empty(&rtc_data->rtc_update->subscribers);
+#endif /* CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS */
+		if (notify) {
+#if CONFIG_RV8803_RTC_TIME_CACHE
+			/* Edge is the start of a second, unless the calendar was read a second later */
+			if ((k_uptime_ticks() - event->uptime) < k_ms_to_ticks_floor64(500)) {
+				rv8803_rtc_anchor_set(dev, event->time, event->uptime);
+			}
+#endif /* CONFIG_RV8803_RTC_TIME_CACHE */
+			/* The event may run every second for other consumers */
+			const struct rv8803_rtc_update *update = rtc_data->rtc_update;
+			if ((update->update_cb != NULL) &&
+			    ((update->period == RV8803_RTC_UPDATE_SECOND) ||
+			     ((event->time[0] & RV8803_SECONDS_BITS) == 0))) {
+				LOG_DBG("Calling Update callback");
+				update->update_cb(dev, update->update_cb_data);
+			}
+#if CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS
+			rv8803_rtc_update_notify(dev, event);
+#endif /* CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS */
+			rv8803_latency_record(rtc_config->base_dev, RV8803_EVENT_UPDATE, event);
+			handled |= RV8803_FLAG_MASK_UPDATE;
+		}
+	}
+#endif
+
+#if RV8803_IRQ_GPIO_USE_EVI
+	if ((event->flag & RV8803_FLAG_MASK_EVENT) && rtc_data->rtc_evi->enabled) {
+		rv8803_rtc_evi_capture(dev, event);
+		if (rtc_data->rtc_evi->evi_cb != NULL) {
+			rtc_data->rtc_evi->evi_cb(dev, rtc_data->rtc_evi->evi_cb_data);
+		}
+		handled |= RV8803_FLAG_MASK_EVENT;
+	}
+#endif /* RV8803_IRQ_GPIO_USE_EVI */
+
+	return handled;
+}
+#endif
+
+#if RV8803_IRQ_GPIO_USE_ALARM
+static bool rv8803_rtc_alarm_time_valid(const struct rtc_time *timeptr, uint16_t mask)
+{
+	if (timeptr->tm_sec != 0) {
+#if CONFIG_RV8803_RTC_ALARM_SECONDS
+		if (!(mask & RTC_ALARM_TIME_MASK_SECOND) ||
+		    (timeptr->tm_sec < 0 || timeptr->tm_sec > 59)) {
+			return false;
+		}
+#else
+		return false;
+#endif /* CONFIG_RV8803_RTC_ALARM_SECONDS */
+	}
+
+	if ((mask & RTC_ALARM_TIME_MASK_MINUTE) && (timeptr->tm_min < 0 || timeptr->tm_min > 59)) {
+		return false;
+	}
+
+	if ((mask & RTC_ALARM_TIME_MASK_HOUR) && (timeptr->tm_hour < 0 || timeptr->tm_hour > 23)) {
+		return false;
+	}
+
+	if (timeptr->tm_mon != 0) {
+		return false;
+	}
+
+	if ((mask & RTC_ALARM_TIME_MASK_MONTHDAY) && (mask & RTC_ALARM_TIME_MASK_WEEKDAY)) {
+		return false;
+	}
+
+	if ((mask & RTC_ALARM_TIME_MASK_MONTHDAY) &&
+	    (timeptr->tm_mday < 1 || timeptr->tm_mday > 31)) {
+		return false;
+	}
+
+	if ((mask & RTC_ALARM_TIME_MASK_WEEKDAY) &&
+	    (timeptr->tm_wday < 0 || timeptr->tm_wday > 6)) {
+		return false;
+	}
+
+	return true;
+}
+
+static int rv8803_rtc_alarm_get_supported_fields(const struct device *dev, uint16_t id,
+						 uint16_t *mask)
+{
+	ARG_UNUSED(dev);
+
+	if (id >= CONFIG_RV8803_RTC_ALARM_COUNT) {
+		return -EINVAL;
+	}
+
+	(*mask) = (RTC_ALARM_TIME_MASK_MINUTE | RTC_ALARM_TIME_MASK_HOUR |
+		   RTC_ALARM_TIME_MASK_MONTHDAY | RTC_ALARM_TIME_MASK_WEEKDAY);
+#if CONFIG_RV8803_RTC_ALARM_SECONDS
+	(*mask) |= RTC_ALARM_TIME_MASK_SECOND;
+#endif /* CONFIG_RV8803_RTC_ALARM_SECONDS */
+
+	return 0;
+}
+
+static bool rv8803_rtc_alarm_day_match(const struct rv8803_rtc_alarm_entry *entry,
+				       const struct tm *day)
+{
+	if ((entry->mask & RTC_ALARM_TIME_MASK_MONTHDAY) && (day->tm_mday != entry->time.tm_mday)) {
+		return false;
+	}
+
+	if ((entry->mask & RTC_ALARM_TIME_MASK_WEEKDAY) && (day->tm_wday != entry->time.tm_wday)) {
+		return false;
+	}
+
+	return true;
+}
+
+/* First second matching the entry after now, -1 when none */
+static int64_t rv8803_rtc_alarm_next(const struct rv8803_rtc_alarm_entry *entry, int64_t now)
+{
+	int64_t midnight = now - (now % RV8803_SECONDS_PER_DAY);
+	int second = 0;
+
+	if (entry->mask & RTC_ALARM_TIME_MASK_SECOND) {
+		second = entry->time.tm_sec;
+	}
+
+	if (entry->mask == 0) {
+		return -1;
+	}
+
+	for (int d = 0; d < RV8803_ALARM_SEARCH_DAYS; d++) {
+		time_t day = midnight + (int64_t)d * RV8803_SECONDS_PER_DAY;
+		struct tm tm;
+
+		gmtime_r(&day, &tm);
+		if (!rv8803_rtc_alarm_day_match(entry, &tm)) {
+			continue;
+		}
+
+		for (int h = 0; h < 24; h++) {
+			if ((entry->mask & RTC_ALARM_TIME_MASK_HOUR) &&
+			    (h != entry->time.tm_hour)) {
+				continue;
+			}
+
+			for (int m = 0; m < 60; m++) {
+				int64_t at = day + (h * RV8803_SECONDS_PER_HOUR) +
+					     (m * RV8803_SECONDS_PER_MINUTE) + second;
+
+				if ((entry->mask & RTC_ALARM_TIME_MASK_MINUTE) &&
+				    (m != entry->time.tm_min)) {
+					continue;
+				}
+				if (at > now) {
+					return at;
+				}
+			}
+		}
+	}
+
+	return -1;
+}
+
+/* Insertion sort of the enabled entries by next occurrence */
+static void rv8803_rtc_alarm_queue(struct rv8803_rtc_alarm *alarm)
+{
+	alarm->armed = 0;
+	for (uint8_t i = 0; i < CONFIG_RV8803_RTC_ALARM_COUNT; i++) {
+		int64_t next = alarm->entries[i].next;
+		uint8_t j = alarm->armed;
+
+		if (next < 0) {
+			continue;
+		}
+
+		while ((j > 0) && (alarm->entries[alarm->order[j - 1]].next > next)) {
+			alarm->order[j] = alarm->order[j - 1];
+			j--;
+		}
+		alarm->order[j] = i;
+		alarm->armed++;
+	}
+}
+
+/*
+ * Called with the bus locked: the minute of the nearest occurrence goes to the alarm registers, AF
+ * is cleared. With second-resolution alarms, an occurrence in the current minute is counted down on
+ * the 1 Hz timer instead: its ticks follow the calendar, so it fires when the second starts.
+ */
+static int rv8803_rtc_alarm_program(const struct device *dev, int64_t now)
+{
+	const struct rv8803_rtc_config *rtc_config = dev->config;
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_alarm *alarm = rtc_data->rtc_alarm;
+	struct rv8803_bus_plan plan;
+	time_t minute;
+	struct tm tm;
+	int err;
+
+	rv8803_bus_plan_init(&plan);
+
+	/* AIE to 0 -> stop interrupt while the alarm registers change */
+	err = rv8803_bus_plan_update(rtc_config->base_dev, &plan, RV8803_REGISTER_CONTROL,
+				     RV8803_ALARM_CONTROL_MASK, RV8803_DISABLE_ALARM);
+#if CONFIG_RV8803_RTC_ALARM_SECONDS
+	/* TE to 0 : stop the countdown, the next rising edge loads it */
+	uint8_t timer_mask = RV8803_EXTENSION_MASK_COUNTER | RV8803_FREQUENCY_MASK_COUNTER;
+	uint8_t timer_value = RV8803_DISABLE_COUNTER | RV8803_COUNTER_FREQUENCY_1_HZ;
+	if (err == 0) {
+		err = rv8803_bus_plan_update(rtc_config->base_dev, &plan,
+					     RV8803_REGISTER_EXTENSION, timer_mask, timer_value);
+	}
+#endif /* CONFIG_RV8803_RTC_ALARM_SECONDS */
+	if (err < 0) {
+		goto commit;
+	}
+
+	/* Nothing armed : Remove alarm interrupt, AF to 0 */
+	if (alarm->armed == 0) {
+		rv8803_bus_plan_flag_clear(&plan, RV8803_ALARM_FLAG_MASK);
+		goto commit;
+	}
+	minute = alarm->entries[alarm->order[0]].next;
+	minute -= minute % RV8803_SECONDS_PER_MINUTE;
+
+#if CONFIG_RV8803_RTC_ALARM_SECONDS
+	if (minute <= now) {
+		uint16_t count = alarm->entries[alarm->order[0]].next - now;
+		uint8_t preset[2] = {count & 0xFF, (count >> 8) & 0x0F};
+
+		/* TC0/TC1, TE to 1, TF to 0 and TIE to 1 follow each other: 0x0B - 0x0F */
+		rv8803_bus_plan_write(&plan, RV8803_REGISTER_TIMER_COUNTER_0, preset,
+				      sizeof(preset));
+		err = rv8803_bus_plan_update(rtc_config->base_dev, &plan,
+					     RV8803_REGISTER_EXTENSION,
+					     RV8803_EXTENSION_MASK_COUNTER, RV8803_ENABLE_COUNTER);
+		if (err < 0) {
+			goto commit;
+		}
+		rv8803_bus_plan_flag_clear(&plan, RV8803_ALARM_FLAG_MASK);
+		err = rv8803_bus_plan_update(rtc_config->base_dev, &plan, RV8803_REGISTER_CONTROL,
+					     RV8803_ALARM_CONTROL_MASK, RV8803_ENABLE_COUNTER);
+		goto commit;
+	}
+#else
+	ARG_UNUSED(now);
+#endif /* CONFIG_RV8803_RTC_ALARM_SECONDS */
+
+	/* Minute, hour and date of the occurrence */
+	gmtime_r(&minute, &tm);
+	uint8_t regs[3];
+	regs[0] = RV8803_ALARM_ENABLE_MINUTES | (bin2bcd(tm.tm_min) & RV8803_MINUTES_BITS);
+	regs[1] = RV8803_ALARM_ENABLE_HOURS | (bin2bcd(tm.tm_hour) & RV8803_HOURS_BITS);
+	regs[2] = RV8803_ALARM_ENABLE_WADA | (bin2bcd(tm.tm_mday) & RV8803_DATE_BITS);
+	rv8803_bus_plan_write(&plan, RV8803_REGISTER_ALARM_MINUTES, regs, sizeof(regs));
+
+	/* WADA, AF to 0 and AIE to 1 follow each other: 0x0D - 0x0F */
+	err = rv8803_bus_plan_update(rtc_config->base_dev, &plan, RV8803_REGISTER_EXTENSION,
+				     RV8803_EXTENSION_MASK_WADA, RV8803_MONTHDAY_ALARM);
+	if (err < 0) {
+		goto commit;
+	}
+	rv8803_bus_plan_flag_clear(&plan, RV8803_ALARM_FLAG_MASK);
+	err = rv8803_bus_plan_update(rtc_config->base_dev, &plan, RV8803_REGISTER_CONTROL,
+				     RV8803_ALARM_CONTROL_MASK, RV8803_ENABLE_ALARM);
+
+commit:
+	if (err == 0) {
+		err = rv8803_bus_plan_commit(rtc_config->base_dev, &plan);
+	}
+	if (err < 0) {
+		LOG_ERR("Write ALARM: [%d]", err);
+	}
+
+	return err;
+}
+
+/* Called with the bus locked: time moved, every occurrence is computed again */
+static int rv8803_rtc_alarm_reschedule(const struct device *dev, int64_t now)
+{
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_alarm *alarm = rtc_data->rtc_alarm;
+
+	for (uint8_t i = 0; i < CONFIG_RV8803_RTC_ALARM_COUNT; i++) {
+		alarm->entries[i].next = rv8803_rtc_alarm_next(&alarm->entries[i], now);
+	}
+	rv8803_rtc_alarm_queue(alarm);
+
+	return rv8803_rtc_alarm_program(dev, now);
+}
+
+/*
+ * Called with the bus locked, calendar is read after AF was raised: entries due are latched
+ * pending and moved to their next occurrence before the nearest one is programmed again. Returns
+ * the mask of the entries due.
+ */
+static uint32_t rv8803_rtc_alarm_expire(const struct device *dev, const uint8_t *calendar)
+{
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_alarm *alarm = rtc_data->rtc_alarm;
+	struct rtc_time time;
+	uint32_t due = 0;
+	int64_t now;
+
+	rv8803_rtc_decode(calendar, &time);
+	now = timeutil_timegm64(rtc_time_to_tm(&time));
+
+	for (uint8_t i = 0; i < CONFIG_RV8803_RTC_ALARM_COUNT; i++) {
+		struct rv8803_rtc_alarm_entry *entry = &alarm->entries[i];
+
+		if ((entry->next >= 0) && (entry->next <= now)) {
+			atomic_set_bit(&alarm->pending, i);
+			entry->next = rv8803_rtc_alarm_next(entry, now);
+			due |= BIT(i);
+		}
+	}
+	rv8803_rtc_alarm_queue(alarm);
+
+	if (rv8803_rtc_alarm_program(dev, now) < 0) {
+		LOG_ERR("Failed to re-arm ALARM!!");
+	}
+
+	return due;
+}
+
+/* Called without the bus lock, callbacks may program alarms */
+static void rv8803_rtc_alarm_notify(const struct device *dev, uint32_t due)
+{
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	const struct rv8803_rtc_alarm_entry *entry;
+
+	for (uint8_t i = 0; i < CONFIG_RV8803_RTC_ALARM_COUNT; i++) {
+		entry = &rtc_data->rtc_alarm->entries[i];
+		if ((due & BIT(i)) && (entry->alarm_cb != NULL)) {
+			LOG_DBG("Calling Alarm [%u] callback", i);
+			entry->alarm_cb(dev, i, entry->alarm_cb_data);
+		}
+	}
+}
+
+static int rv8803_rtc_alarm_set_time(const struct device *dev, uint16_t id, uint16_t mask,
+				     const struct rtc_time *timeptr)
+{
+	const struct rv8803_rtc_config *rtc_config = dev->config;
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_alarm_entry *entry;
+	uint8_t calendar[RV8803_CALENDAR_SIZE];
+	enum rv8803_bus_caller caller;
+	struct rtc_time now;
+	uint8_t hundredths;
+	int64_t ticks;
+	int64_t second;
+	int err;
+
+	if (id >= CONFIG_RV8803_RTC_ALARM_COUNT) {
+		return -EINVAL;
+	}
+
+	if ((timeptr == NULL) && (mask > 0)) {
+		LOG_ERR("Invalid time pointer!!");
+		return -EINVAL;
+	}
+
+	if ((mask > 0) && !rv8803_rtc_alarm_time_valid(timeptr, mask)) {
+		LOG_ERR("Invalid Time / Mask!!");
+		return -EINVAL;
+	}
+
+	/* The next occurrence is counted from the current calendar minute */
+	caller = rv8803_bus_lock(rtc_config->base_dev, RV8803_BUS_CALLER_ALARM);
+	err = rv8803_rtc_read(dev, calendar, &hundredths, &ticks);
+	if (err < 0) {
+		goto unlock;
+	}
+	rv8803_rtc_decode(calendar, &now);
+	second = timeutil_timegm64(rtc_time_to_tm(&now));
+
+	entry = &rtc_data->rtc_alarm->entries[id];
+	entry->mask = mask;
+	atomic_clear_bit(&rtc_data->rtc_alarm->pending, id);
+	if (mask > 0) {
+		entry->time = *timeptr;
+	}
+	entry->next = rv8803_rtc_alarm_next(entry, second);
+	rv8803_rtc_alarm_queue(rtc_data->rtc_alarm);
+
+	err = rv8803_rtc_alarm_program(dev, second);
+
+unlock:
+	rv8803_bus_unlock(rtc_config->base_dev, caller);
+
+	return err;
+}
+
+static int rv8803_rtc_alarm_get_time(const struct device *dev, uint16_t id, uint16_t *mask,
+				     struct rtc_time *timeptr)
+{
+	const struct rv8803_rtc_config *rtc_config = dev->config;
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	const struct rv8803_rtc_alarm_entry *entry;
+	enum rv8803_bus_caller caller;
+
+	if ((timeptr == NULL) || (id >= CONFIG_RV8803_RTC_ALARM_COUNT)) {
+		return -EINVAL;
+	}
+
+	/* Served from RAM, the alarm registers only hold the nearest entry */
+	caller = rv8803_bus_lock(rtc_config->base_dev, RV8803_BUS_CALLER_ALARM);
+	entry = &rtc_data->rtc_alarm->entries[id];
+	(*mask) = entry->mask;
+	if (entry->mask & RTC_ALARM_TIME_MASK_SECOND) {
+		timeptr->tm_sec = entry->time.tm_sec;
+	}
+	if (entry->mask & RTC_ALARM_TIME_MASK_MINUTE) {
+		timeptr->tm_min = entry->time.tm_min;
+	}
+	if (entry->mask & RTC_ALARM_TIME_MASK_HOUR) {
+		timeptr->tm_hour = entry->time.tm_hour;
+	}
+	if (entry->mask & RTC_ALARM_TIME_MASK_WEEKDAY) {
+		timeptr->tm_wday = entry->time.tm_wday;
+	}
+	if (entry->mask & RTC_ALARM_TIME_MASK_MONTHDAY) {
+		timeptr->tm_mday = entry->time.tm_mday;
+	}
+	rv8803_bus_unlock(rtc_config->base_dev, caller);
+
+	return 0;
+}
+
+static int rv8803_rtc_alarm_is_pending(const struct device *dev, uint16_t id)
+{
+	const struct rv8803_rtc_config *rtc_config = dev->config;
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	enum rv8803_bus_caller caller;
+	uint8_t regs[RV8803_REGISTER_FLAG + 1];
+	uint32_t due = 0;
+	int err;
+
+	if (id >= CONFIG_RV8803_RTC_ALARM_COUNT) {
+		return -EINVAL;
+	}
+
+	/* Interrupt wired: AF is expired by the dispatcher, pending bits are in RAM */
+	const struct rv8803_config *config = rtc_config->base_dev->config;
+	if (config->gpio->irq_gpio.port != NULL) {
+		return atomic_test_and_clear_bit(&rtc_data->rtc_alarm->pending, id) ? 1 : 0;
+	}
+
+	/* No interrupt: AF is polled and the entries expired now */
+	caller = rv8803_bus_lock(rtc_config->base_dev, RV8803_BUS_CALLER_ALARM);
+	err = rv8803_bus_burst_read(rtc_config->base_dev, RV8803_REGISTER_SECONDS, regs,
+				    sizeof(regs));
+	if ((err == 0) && (regs[RV8803_REGISTER_FLAG] & RV8803_ALARM_FLAG_MASK)) {
+		due = rv8803_rtc_alarm_expire(dev, regs);
+	}
+	if ((err == 0) && atomic_test_and_clear_bit(&rtc_data->rtc_alarm->pending, id)) {
+		err = 1;
+	}
+	rv8803_bus_unlock(rtc_config->base_dev, caller);
+
+	rv8803_rtc_alarm_notify(dev, due);
+
+	return err;
+}
+
+static int rv8803_rtc_alarm_set_callback(const struct device *dev, uint16_t id,
+					 rtc_alarm_callback callback, void *user_data)
+{
+	const struct rv8803_rtc_config *rtc_config = dev->config;
+	const struct rv8803_config *config = rtc_config->base_dev->config;
+	if (config->gpio->irq_gpio.port == NULL) {
+		return -ENOTSUP;
+	}
+	if (id >= CONFIG_RV8803_RTC_ALARM_COUNT) {
+		return -EINVAL;
+	}
+
+	struct rv8803_rtc_data *data = dev->data;
+	data->rtc_alarm->entries[id].alarm_cb = callback;
+	data->rtc_alarm->entries[id].alarm_cb_data = user_data;
+
+	return 0;
+}
+#endif /* CONFIG_RTC_ALARM */
+#endif
+
+#if RV8803_IRQ_GPIO_USE_UPDATE
+/*
+ * Single transaction. When the interrupt already runs only USEL is written: UF and the other flags
+ * stay pending. Otherwise UF is cleared before UIE is set.
+ */
+static int rv8803_setup_update_interrupt(const struct device *dev, bool disable, uint8_t period)
+{
+	const struct rv8803_rtc_config *rtc_config = dev->config;
+	struct rv8803_bus_plan plan;
+	enum rv8803_bus_caller caller;
+	uint8_t control;
+	int err;
+
+	caller = rv8803_bus_lock(rtc_config->base_dev, RV8803_BUS_CALLER_UPDATE);
+	rv8803_bus_plan_init(&plan);
+
+	/* Served from the shadow copy */
+	err = rv8803_bus_reg_read(rtc_config->base_dev, RV8803_REGISTER_CONTROL, &control);
+	if (err < 0) {
+		goto unlock;
+	}
+
+	/* UIE and UF to 0 : stop interrupt */
+	if (disable) {
+		err = rv8803_bus_plan_update(rtc_config->base_dev, &plan, RV8803_REGISTER_CONTROL,
+					     RV8803_CONTROL_MASK_UPDATE, RV8803_DISABLE_UPDATE);
+		rv8803_bus_plan_flag_clear(&plan, RV8803_FLAG_MASK_UPDATE);
+		goto commit;
+	}
+
+	/* Choose USEL value */
+	err = rv8803_bus_plan_update(rtc_config->base_dev, &plan, RV8803_REGISTER_EXTENSION,
+				     RV8803_EXTENSION_MASK_UPDATE, period);
+	if ((err < 0) || (control & RV8803_CONTROL_MASK_UPDATE)) {
+		goto commit;
+	}
+
+	/* UF to 0 and UIE to 1 : start interrupt (0x0E - 0x0F) */
+	rv8803_bus_plan_flag_clear(&plan, RV8803_FLAG_MASK_UPDATE);
+	err = rv8803_bus_plan_update(rtc_config->base_dev, &plan, RV8803_REGISTER_CONTROL,
+				     RV8803_CONTROL_MASK_UPDATE, RV8803_ENABLE_UPDATE);
+
+commit:
+	if (err == 0) {
+		err = rv8803_bus_plan_commit(rtc_config->base_dev, &plan);
+	}
+
+unlock:
+	rv8803_bus_unlock(rtc_config->base_dev, caller);
+
+	return err;
+}
+
+/*
+ * Update interrupt on while anything consumes it, on the minute event when no consumer needs
+ * every second: the drift estimator and the rtc_update callback on a second period do.
+ */
+static int rv8803_rtc_update_refresh(const struct device *dev)
+{
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	bool enable = (rtc_data->rtc_update->update_cb != NULL);
+	bool seconds = enable && (rtc_data->rtc_update->period == RV8803_RTC_UPDATE_SECOND);
+
+#if CONFIG_RV8803_RTC_DISCIPLINE
+	seconds = seconds || rtc_data->rtc_discipline->running;
+	enable = enable || rtc_data->rtc_discipline->running;
+#endif /* CONFIG_RV8803_RTC_DISCIPLINE */
+#if CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS
+	struct rv8803_rtc_update_subscriber *subscriber;
+
+	k_mutex_lock(&rtc_data->rtc_update->lock, K_FOREVER);
+	SYS_SLIST_FOR_EACH_CONTAINER(&rtc_data->rtc_update->subscribers, subscriber, node) {
+		enable = true;
+		seconds = seconds || ((subscriber->period % RV8803_SECONDS_PER_MINUTE) != 0);
+	}
+	k_mutex_unlock(&rtc_data->rtc_update->lock);
+#endif /* CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS */
+
+	return rv8803_setup_update_interrupt(dev, !enable,
+					     seconds ? RV8803_UPDATE_PERIOD_SECOND
+						     : RV8803_UPDATE_PERIOD_MINUTE);
+}
+
+static int rv8803_update_set_callback(const struct device *dev, rtc_update_callback callback,
+				      void *user_data)
+{
+	const struct rv8803_rtc_config *rtc_config = dev->config;
+	const struct rv8803_config *config = rtc_config->base_dev->config;
+	if (config->gpio->irq_gpio.port == NULL) {
+		return -ENOTSUP;
+	}
+
+	struct rv8803_rtc_data *data = dev->data;
+	data->rtc_update->update_cb = callback;
+	data->rtc_update->update_cb_data = user_data;
+
+	if ((callback == NULL) && (user_data != NULL)) {
+		return -EINVAL;
+	}
+	int err = rv8803_rtc_update_refresh(dev);
+	if (err < 0) {
+		return err;
+	}
+
+	return 0;
+}
+
+int rv8803_rtc_update_period_set(const struct device *dev, enum rv8803_rtc_update_period period)
+{
+	struct rv8803_rtc_data *rtc_data = dev->data;
+
+	if ((period != RV8803_RTC_UPDATE_SECOND) && (period != RV8803_RTC_UPDATE_MINUTE)) {
+		return -EINVAL;
+	}
+
+	rtc_data->rtc_update->period = period;
+
+	return rv8803_rtc_update_refresh(dev);
+}
+
+enum rv8803_rtc_update_period rv8803_rtc_update_period_get(const struct device *dev)
+{
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+
+	return rtc_data->rtc_update->period;
+}
+
+#if CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS
+/* Decimation follows the calendar, so a 60 s subscriber is called at the start of each minute */
+static void rv8803_rtc_update_notify(const struct device *dev, const struct rv8803_event *event)
+{
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_update_subscriber *subscriber;
+	struct rv8803_rtc_update_subscriber *next;
+	struct rtc_time time;
+	int64_t second;
+
+	rv8803_rtc_decode(event->time, &time);
+	second = timeutil_timegm64(rtc_time_to_tm(&time));
+
+	/* Subscribers may unsubscribe from their callback */
+	k_mutex_lock(&rtc_data->rtc_update->lock, K_FOREVER);
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&rtc_data->rtc_update->subscribers, subscriber, next,
+					  node) {
+		if ((second % subscriber->period) == 0) {
+			subscriber->callback(dev, subscriber->user_data);
+		}
+	}
+	k_mutex_unlock(&rtc_data->rtc_update->lock);
+}
+
+int rv8803_rtc_update_subscribe(const struct device *dev,
+				struct rv8803_rtc_update_subscriber *subscriber)
+{
+	const struct rv8803_rtc_config *rtc_config = dev->config;
+	const struct rv8803_config *config = rtc_config->base_dev->config;
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	int err = 0;
+
+	if (config->gpio->irq_gpio.port == NULL) {
+		return -ENOTSUP;
+	}
+
+	if ((subscriber == NULL) || (subscriber->callback == NULL) || (subscriber->period == 0)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&rtc_data->rtc_update->lock, K_FOREVER);
+	if (sys_slist_find(&rtc_data->rtc_update->subscribers, &subscriber->node, NULL)) {
+		err = -EALREADY;
+	} else {
+		sys_slist_append(&rtc_data->rtc_update->subscribers, &subscriber->node);
+	}
+	k_mutex_unlock(&rtc_data->rtc_update->lock);
 	if (err < 0) {
 		return err;
 	}
 
-	/* Write new time to RTC register */
-	i2c_burst_write_dt(&config->i2c_bus, RV8803_REGISTER_SECONDS, regs, sizeof(regs));
-
-	/* Restart time update clock */
-	control_reg[0] &= ~RV8803_RESET_BIT;
-	return i2c_burst_write_dt(&config->i2c_bus, RV8803_REGISTER_CONTROL, control_reg,
-				  sizeof(control_reg));
+	return rv8803_rtc_update_refresh(dev);
 }
 
-static int rv8803_rtc_get_time(const struct device *dev, struct rtc_time *timeptr)
+int rv8803_rtc_update_unsubscribe(const struct device *dev,
+				  struct rv8803_rtc_update_subscriber *subscriber)
 {
-	if (timeptr == NULL) {
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	bool found;
+
+	if (subscriber == NULL) {
 		return -EINVAL;
 	}
 
-	/* Init variables for i2c communication */
-	const struct rv8803_rtc_config *rtc_config = dev->config;
-	const struct rv8803_config *config = rtc_config->base_dev->config;
-	uint8_t regs1[7];
-	uint8_t regs2[7];
-	uint8_t *correct = regs1;
-	int err;
-
-	err = i2c_burst_read_dt(&config->i2c_bus, RV8803_REGISTER_SECONDS, regs1, sizeof(regs1));
-	if (err < 0) {
-		return err;
+	k_mutex_lock(&rtc_data->rtc_update->lock, K_FOREVER);
+	found = sys_slist_find_and_remove(&rtc_data->rtc_update->subscribers, &subscriber->node);
+	k_mutex_unlock(&rtc_data->rtc_update->lock);
+	if (!found) {
+		return -ENOENT;
 	}
 
-	/* Check to confirm correct time */
-	if ((regs1[0] & RV8803_SECONDS_BITS) == bin2bcd(59)) {
-		err = i2c_burst_read_dt(&config->i2c_bus, RV8803_REGISTER_SECONDS, regs2,
-					sizeof(regs2));
-		if (err < 0) {
-			return err;
-		}
-		if ((regs2[0] & RV8803_SECONDS_BITS) != bin2bcd(59)) {
-			correct = regs2;
-		}
-	}
+	return rv8803_rtc_update_refresh(dev);
+}
+#endif /* CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS */
+#endif /* CONFIG_RTC */
 
-	timeptr->tm_sec = bcd2bin(correct[0] & RV8803_SECONDS_BITS);
-	timeptr->tm_min = bcd2bin(correct[1] & RV8803_MINUTES_BITS);
-	timeptr->tm_hour = bcd2bin(correct[2] & RV8803_HOURS_BITS);
-	timeptr->tm_wday = log2(correct[3] & RV8803_WEEKDAY_BITS);
-	timeptr->tm_mday = bcd2bin(correct[4] & RV8803_DATE_BITS);
-	timeptr->tm_mon = bcd2bin(correct[5] & RV8803_MONTH_BITS) - RV8803_TM_MONTH;
-	timeptr->tm_year = bcd2bin(correct[6] & RV8803_YEAR_BITS) + RV8803_CORRECT_YEAR_LEAP_MIN;
+#if CONFIG_RTC && CONFIG_RV8803_RTC_ENABLE && CONFIG_RTC_CALIBRATION
+/* Parts per billion to offset steps, rounded to the nearest step */
+static int rv8803_rtc_calibration_to_offset(int32_t calibration, uint8_t *offset)
+{
+	int64_t num = (int64_t)calibration * 10;
+	int64_t half = RV8803_OFFSET_STEP_PPB_X10 / 2;
+	int64_t steps = (num + ((num < 0) ? -half : half)) / RV8803_OFFSET_STEP_PPB_X10;
 
-	/* Unused */
-	timeptr->tm_nsec = 0;
-	timeptr->tm_isdst = -1;
-	timeptr->tm_yday = -1;
+	if ((steps < RV8803_OFFSET_MIN) || (steps > RV8803_OFFSET_MAX)) {
+		return -EINVAL;
+	}
+
+	*offset = (uint8_t)steps & RV8803_OFFSET_BITS;
 
-	LOG_DBG("Get time: year[%u] month[%u] mday[%u] wday[%u] hours[%u] minutes[%u] seconds[%u]",
-		timeptr->tm_year, timeptr->tm_mon, timeptr->tm_mday, timeptr->tm_wday,
-		timeptr->tm_hour, timeptr->tm_min, timeptr->tm_sec);
 	return 0;
 }
 
-#if RV8803_IRQ_GPIO_IN_USE
-static void rv8803_rtc_worker(struct k_work *p_work)
+/* Offset steps to parts per billion, rounded to the nearest ppb */
+static int32_t rv8803_rtc_offset_to_calibration(uint8_t offset)
 {
-	struct rv8803_irq *data = CONTAINER_OF(p_work, struct rv8803_irq, rtc_work);
-	const struct rv8803_rtc_config *rtc_config = data->rtc_dev->config;
-	const struct rv8803_rtc_data *rtc_data = data->rtc_dev->data;
-	const struct rv8803_config *config = rtc_config->base_dev->config;
-	uint8_t reg;
-	int err;
-
-	LOG_DBG("Process Alarm worker from interrupt");
-
-	err = i2c_reg_read_byte_dt(&config->i2c_bus, RV8803_REGISTER_FLAG, &reg);
-	if (err < 0) {
-		LOG_ERR("Alarm worker I2C read FLAGS error");
-	}
-
-#if RV8803_IRQ_GPIO_USE_ALARM
-	if (reg & RV8803_FLAG_MASK_ALARM) {
-		if (rtc_data->rtc_alarm->alarm_cb != NULL) {
-			LOG_DBG("Calling Alarm callback");
-			rtc_data->rtc_alarm->alarm_cb(data->rtc_dev, 0,
-						      rtc_data->rtc_alarm->alarm_cb_data);
-
-			err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_FLAG,
-						     RV8803_FLAG_MASK_ALARM, RV8803_DISABLE_ALARM);
-			if (err < 0) {
-				LOG_ERR("GPIO worker I2C update ALARM FLAG error");
-			}
-		}
-	}
-#endif
+	/* Sign extension of the 6-bit value */
+	int32_t steps = (int32_t)(offset & RV8803_OFFSET_BITS) - ((offset & BIT(5)) ? 64 : 0);
 
-#if RV8803_IRQ_GPIO_USE_UPDATE
-	if (reg & RV8803_FLAG_MASK_UPDATE) {
-		if (rtc_data->rtc_update->update_cb != NULL) {
-			LOG_DBG("Calling Update callback");
-			rtc_data->rtc_update->update_cb(data->rtc_dev,
-							rtc_data->rtc_update->update_cb_data);
-
-			err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_FLAG,
-						     RV8803_FLAG_MASK_UPDATE,
-						     RV8803_DISABLE_UPDATE);
-			if (err < 0) {
-				LOG_ERR("GPIO worker I2C update UPDATE FLAG error");
-			}
-		}
-	}
-#endif
+	return (steps * RV8803_OFFSET_STEP_PPB_X10 + ((steps < 0) ? -5 : 5)) / 10;
 }
-#endif
 
-#if RV8803_IRQ_GPIO_USE_ALARM
-static bool rv8803_rtc_alarm_time_valid(const struct rtc_time *timeptr, uint16_t mask)
+static int rv8803_rtc_set_calibration(const struct device *dev, int32_t calibration)
 {
-	if (timeptr->tm_sec != 0) {
-		return false;
-	}
+	const struct rv8803_rtc_config *rtc_config = dev->config;
+	enum rv8803_bus_caller caller;
+	uint8_t offset;
+	int err;
 
-	if ((mask & RTC_ALARM_TIME_MASK_MINUTE) && (timeptr->tm_min < 0 || timeptr->tm_min > 59)) {
-		return false;
+	err = rv8803_rtc_calibration_to_offset(calibration, &offset);
+	if (err < 0) {
+		LOG_ERR("Calibration out of range: [%d] ppb", calibration);
+		return err;
 	}
 
-	if ((mask & RTC_ALARM_TIME_MASK_HOUR) && (timeptr->tm_hour < 0 || timeptr->tm_hour > 23)) {
-		return false;
+	caller = rv8803_bus_lock(rtc_config->base_dev, RV8803_BUS_CALLER_OTHER);
+	err = rv8803_bus_reg_write(rtc_config->base_dev, RV8803_REGISTER_OFFSET, offset);
+	rv8803_bus_unlock(rtc_config->base_dev, caller);
+#if CONFIG_RV8803_RTC_DISCIPLINE
+	if (err == 0) {
+		rv8803_rtc_discipline_offset_set(dev, offset);
 	}
+#endif /* CONFIG_RV8803_RTC_DISCIPLINE */
 
-	if (timeptr->tm_mon != 0) {
-		return false;
-	}
+	return err;
+}
 
-	if ((mask & RTC_ALARM_TIME_MASK_MONTHDAY) && (mask & RTC_ALARM_TIME_MASK_WEEKDAY)) {
-		return false;
-	}
+static int rv8803_rtc_get_calibration(const struct device *dev, int32_t *calibration)
+{
+	const struct rv8803_rtc_config *rtc_config = dev->config;
+	enum rv8803_bus_caller caller;
+	uint8_t offset;
+	int err;
 
-	if ((mask & RTC_ALARM_TIME_MASK_MONTHDAY) &&
-	    (timeptr->tm_mday < 1 || timeptr->tm_mday > 31)) {
-		return false;
+	caller = rv8803_bus_lock(rtc_config->base_dev, RV8803_BUS_CALLER_OTHER);
+	err = rv8803_bus_reg_read(rtc_config->base_dev, RV8803_REGISTER_OFFSET, &offset);
+	rv8803_bus_unlock(rtc_config->base_dev, caller);
+	if (err < 0) {
+		return err;
 	}
 
-	if ((mask & RTC_ALARM_TIME_MASK_WEEKDAY) &&
-	    (timeptr->tm_wday < 0 || timeptr->tm_wday > 6)) {
-		return false;
-	}
+	*calibration = rv8803_rtc_offset_to_calibration(offset);
 
-	return true;
+	return 0;
 }
+#endif /* CONFIG_RTC && CONFIG_RV8803_RTC_ENABLE && CONFIG_RTC_CALIBRATION */
 
-static int rv8803_rtc_alarm_get_supported_fields(const struct device *dev, uint16_t id,
-						 uint16_t *mask)
+#if CONFIG_RV8803_RTC_DISCIPLINE
+/* Phase samples break across a time or calibration change */
+static void rv8803_rtc_discipline_invalidate(const struct device *dev)
 {
-	ARG_UNUSED(dev);
-	ARG_UNUSED(id);
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_discipline *disc = rtc_data->rtc_discipline;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&disc->lock);
+	disc->ref_pending = false;
+	disc->pps_valid = false;
+	disc->last_valid = false;
+	k_spin_unlock(&disc->lock, key);
+}
 
-	(*mask) = (RTC_ALARM_TIME_MASK_MINUTE | RTC_ALARM_TIME_MASK_HOUR |
-		   RTC_ALARM_TIME_MASK_MONTHDAY | RTC_ALARM_TIME_MASK_WEEKDAY);
+static void rv8803_rtc_discipline_offset_set(const struct device *dev, uint8_t offset)
+{
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_discipline *disc = rtc_data->rtc_discipline;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&disc->lock);
+	disc->offset = offset;
+	disc->calibration = rv8803_rtc_offset_to_calibration(offset);
+	disc->last_valid = false;
+	k_spin_unlock(&disc->lock, key);
+}
 
-	return 0;
+/* Reference edge, paired with the next update edge by the interrupt worker */
+static void rv8803_rtc_discipline_store(struct rv8803_rtc_discipline *disc, bool pps,
+					int64_t ref_ns)
+{
+	uint32_t cycles = k_cycle_get_32();
+	int64_t ticks = k_uptime_ticks();
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&disc->lock);
+	disc->ref_pending = true;
+	disc->ref_pps = pps;
+	disc->ref_ns = ref_ns;
+	disc->ref_ticks = ticks;
+	disc->ref_cycles = cycles;
+	k_spin_unlock(&disc->lock, key);
 }
-static int rv8803_rtc_alarm_set_time(const struct device *dev, uint16_t id, uint16_t mask,
-				     const struct rtc_time *timeptr)
+
+static void rv8803_rtc_discipline_pps_handler(const struct device *p_port,
+					      struct gpio_callback *p_cb, gpio_port_pins_t pins)
 {
-	ARG_UNUSED(id);
-	const struct rv8803_rtc_config *rtc_config = dev->config;
-	const struct rv8803_config *config = rtc_config->base_dev->config;
-	int err;
+	ARG_UNUSED(p_port);
+	ARG_UNUSED(pins);
 
-	if ((timeptr == NULL) && (mask > 0)) {
-		LOG_ERR("Invalid time pointer!!");
-		return -EINVAL;
-	}
+	struct rv8803_rtc_discipline *disc =
+		CONTAINER_OF(p_cb, struct rv8803_rtc_discipline, pps_cb);
 
-	if (!rv8803_rtc_alarm_time_valid(timeptr, mask)) {
-		LOG_ERR("Invalid Time / Mask!!");
-		return -EINVAL;
+	if (disc->running) {
+		rv8803_rtc_discipline_store(disc, true, 0);
 	}
+}
 
-	/* Mask = 0 : Remove alarm interrupt */
-	if (mask == 0) {
-		err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_CONTROL,
-					     RV8803_CONTROL_MASK_ALARM, RV8803_DISABLE_ALARM);
-		if (err < 0) {
-			LOG_ERR("Update CONTROL: [%d]", err);
-			return err;
-		}
-		err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_FLAG,
-					     RV8803_FLAG_MASK_ALARM, RV8803_DISABLE_ALARM);
-		if (err < 0) {
-			LOG_ERR("Update FLAG: [%d]", err);
-			return err;
+/*
+ * Called with the lock held, rtc_ns is the RTC time at the reference edge. Once the reference moved
+ * by CONFIG_RV8803_RTC_DISCIPLINE_INTERVAL, the phase change gives the RTC rate, from which the
+ * applied calibration is removed. Returns true when offset has to be written to the device.
+ */
+static bool rv8803_rtc_discipline_sample(struct rv8803_rtc_discipline *disc, int64_t rtc_ns,
+					 uint8_t *offset)
+{
+	int64_t ref_ns = disc->ref_ns;
+	int64_t error_ns;
+	int64_t span;
+	int64_t rate;
+	int64_t weight;
+	int64_t var;
+	uint32_t window;
+
+	/* PPS edges are numbered from the first one, by rounding the kernel time elapsed */
+	if (disc->ref_pps) {
+		if (disc->pps_valid) {
+			int64_t ms = k_ticks_to_ms_near64(disc->ref_ticks - disc->pps_ticks);
+
+			ref_ns = disc->pps_ns + DIV_ROUND_CLOSEST(ms, MSEC_PER_SEC) * NSEC_PER_SEC;
+		} else {
+			ref_ns = rtc_ns - (rtc_ns % NSEC_PER_SEC);
 		}
-
-		return 0;
+		disc->pps_valid = true;
+		disc->pps_ns = ref_ns;
+		disc->pps_ticks = disc->ref_ticks;
 	}
 
-	/* AIE and AF to 0 -> stop interrupt and clear interrupt flags */
-	err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_CONTROL,
-				     RV8803_CONTROL_MASK_ALARM, RV8803_DISABLE_ALARM);
-	if (err < 0) {
-		LOG_ERR("Update CONTROL: [%d]", err);
-		return err;
+	error_ns = rtc_ns - ref_ns;
+	span = ref_ns - disc->last_ref_ns;
+	if (!disc->last_valid || (span <= 0)) {
+		goto restart;
 	}
-	err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_FLAG, RV8803_FLAG_MASK_ALARM,
-				     RV8803_DISABLE_ALARM);
-	if (err < 0) {
-		LOG_ERR("Update FLAG: [%d]", err);
-		return err;
+	if (span < ((int64_t)CONFIG_RV8803_RTC_DISCIPLINE_INTERVAL * NSEC_PER_SEC)) {
+		return false;
 	}
 
-	/* Set WADA to 0 or 1 */
-	uint8_t wada = RV8803_WEEKDAY_ALARM;
-	if (mask && RTC_ALARM_TIME_MASK_MONTHDAY) {
-		wada = RV8803_MONTHDAY_ALARM;
-	}
-	err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_EXTENSION,
-				     RV8803_EXTENSION_MASK_WADA, wada);
-	if (err < 0) {
-		LOG_ERR("Update EXTENSION: [%d]", err);
-		return err;
+	/* A phase step rather than a rate: missed pulse or reference jump */
+	if (llabs(error_ns - disc->last_error_ns) >
+	    (span / (NSEC_PER_SEC / RV8803_RTC_DISCIPLINE_MAX_PPB))) {
+		LOG_WRN("Discipline sample dropped");
+		goto restart;
 	}
 
-	/* Set desired time and alarm */
-	uint8_t regs[3];
-	if (mask & RTC_ALARM_TIME_MASK_MINUTE) {
-		regs[0] = RV8803_ALARM_ENABLE_MINUTES;
-		regs[0] |= bin2bcd(timeptr->tm_min) & RV8803_MINUTES_BITS;
-	} else {
-		regs[0] = RV8803_ALARM_DISABLE_MINUTES;
-	}
+	rate = ((error_ns - disc->last_error_ns) * (int64_t)NSEC_PER_SEC) / span;
+	rate -= disc->calibration;
+	weight = span / NSEC_PER_SEC;
+	window = CONFIG_RV8803_RTC_DISCIPLINE_SAMPLES;
 
-	if (mask & RTC_ALARM_TIME_MASK_HOUR) {
-		regs[1] = RV8803_ALARM_ENABLE_HOURS;
-		regs[1] |= bin2bcd(timeptr->tm_hour) & RV8803_HOURS_BITS;
-	} else {
-		regs[1] = RV8803_ALARM_DISABLE_HOURS;
+	/* Older intervals fade out once the window is full */
+	if (disc->samples >= window) {
+		disc->sum_w -= disc->sum_w / window;
+		disc->sum_wx -= disc->sum_wx / window;
+		disc->sum_wxx -= disc->sum_wxx / window;
 	}
-
-	if (mask & RTC_ALARM_TIME_MASK_WEEKDAY) {
-		regs[2] = RV8803_ALARM_ENABLE_WADA;
-		regs[2] |= (1 << timeptr->tm_wday) & RV8803_WEEKDAY_BITS;
-	} else if (mask & RTC_ALARM_TIME_MASK_MONTHDAY) {
-		regs[2] = RV8803_ALARM_ENABLE_WADA;
-		regs[2] |= bin2bcd(timeptr->tm_mday) & RV8803_DATE_BITS;
-	} else {
-		regs[2] = RV8803_ALARM_DISABLE_WADA;
+	disc->sum_w += weight;
+	disc->sum_wx += weight * rate;
+	disc->sum_wxx += weight * rate * rate;
+	disc->samples++;
+
+	disc->ppb = disc->sum_wx / disc->sum_w;
+	if (disc->samples >= 2) {
+		var = (disc->sum_wxx / disc->sum_w) - ((int64_t)disc->ppb * disc->ppb);
+		disc->uncertainty_ppb =
+			(uint32_t)sqrt((double)MAX(var, 0) / MIN(disc->samples, window));
 	}
 
-	err = i2c_burst_write_dt(&config->i2c_bus, RV8803_REGISTER_ALARM_MINUTES, regs,
-				 sizeof(regs));
-	if (err < 0) {
-		LOG_ERR("Write ALARM: [%d]", err);
-		return err;
+restart:
+	disc->last_valid = true;
+	disc->last_ref_ns = ref_ns;
+	disc->last_error_ns = error_ns;
+
+	/* Cancel the error once it is known within half an OFFSET step */
+	if ((disc->samples < RV8803_RTC_DISCIPLINE_MIN_SAMPLES) ||
+	    (disc->uncertainty_ppb > (RV8803_OFFSET_STEP_PPB_X10 / 20))) {
+		return false;
 	}
 
-	/* AIE 1 -> activate interrupt */
-	err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_CONTROL,
-				     RV8803_CONTROL_MASK_ALARM, RV8803_ENABLE_ALARM);
-	if (err < 0) {
-		LOG_ERR("Update CONTROL: [%d]", err);
-		return err;
+	int32_t target = CLAMP(-disc->ppb, RV8803_OFFSET_MIN * RV8803_OFFSET_STEP_PPB_X10 / 10,
+			       RV8803_OFFSET_MAX * RV8803_OFFSET_STEP_PPB_X10 / 10);
+
+	if ((rv8803_rtc_calibration_to_offset(target, offset) < 0) || (*offset == disc->offset)) {
+		return false;
 	}
 
-	return 0;
+	/* The next interval runs with the new correction */
+	disc->offset = *offset;
+	disc->calibration = rv8803_rtc_offset_to_calibration(*offset);
+
+	return true;
 }
 
-static int rv8803_rtc_alarm_get_time(const struct device *dev, uint16_t id, uint16_t *mask,
-				     struct rtc_time *timeptr)
+/* Update edge: returns true while the estimator runs */
+static bool rv8803_rtc_discipline_edge(const struct device *dev, const struct rv8803_event *event)
 {
-	ARG_UNUSED(id);
 	const struct rv8803_rtc_config *rtc_config = dev->config;
-	const struct rv8803_config *config = rtc_config->base_dev->config;
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_discipline *disc = rtc_data->rtc_discipline;
+	int64_t second = k_ms_to_ticks_floor64(MSEC_PER_SEC);
+	enum rv8803_bus_caller caller;
+	struct rtc_time time;
+	k_spinlock_key_t key;
+	bool apply = false;
+	uint8_t offset;
+	int64_t rtc_ns;
+	int32_t cycles;
 	int err;
 
-	if (timeptr == NULL) {
-		return -EINVAL;
-	}
-	(*mask) = 0;
+	rv8803_rtc_decode(event->time, &time);
+	rtc_ns = timeutil_timegm64(rtc_time_to_tm(&time)) * NSEC_PER_SEC;
 
-	uint8_t regs[3];
-	err = i2c_burst_read_dt(&config->i2c_bus, RV8803_REGISTER_ALARM_MINUTES, regs,
-				sizeof(regs));
-	if (err < 0) {
-		return err;
+	key = k_spin_lock(&disc->lock);
+	if (!disc->running) {
+		k_spin_unlock(&disc->lock, key);
+		return false;
 	}
 
-	if ((regs[0] & RV8803_ALARM_MASK_MINUTES) == RV8803_ALARM_ENABLE_MINUTES) {
-		(*mask) |= RTC_ALARM_TIME_MASK_MINUTE;
-		timeptr->tm_min = bcd2bin(regs[0] & RV8803_MINUTES_BITS);
-	}
+	/* Edge is the start of a second, unless the calendar was read a second later */
+	if (disc->ref_pending && ((k_uptime_ticks() - event->uptime) < (second / 2)) &&
+	    (llabs(disc->ref_ticks - event->uptime) < second)) {
+		/* RTC time at the reference edge, bridged with the cycle counter */
+		cycles = (int32_t)(disc->ref_cycles - event->isr_cycles);
+		if (cycles < 0) {
+			rtc_ns -= k_cyc_to_ns_floor64(-(int64_t)cycles);
+		} else {
+			rtc_ns += k_cyc_to_ns_floor64(cycles);
+		}
 
-	if ((regs[1] & RV8803_ALARM_MASK_HOURS) == RV8803_ALARM_ENABLE_HOURS) {
-		(*mask) |= RTC_ALARM_TIME_MASK_HOUR;
-		timeptr->tm_hour = bcd2bin(regs[1] & RV8803_HOURS_BITS);
+		disc->ref_pending = false;
+		apply = rv8803_rtc_discipline_sample(disc, rtc_ns, &offset);
 	}
+	k_spin_unlock(&disc->lock, key);
 
-	if ((regs[2] & RV8803_ALARM_MASK_WADA) == RV8803_ALARM_ENABLE_WADA) {
-		uint8_t wada;
-		err = i2c_reg_read_byte_dt(&config->i2c_bus, RV8803_REGISTER_EXTENSION, &wada);
-		if (err < 0) {
-			return err;
-		}
+	if (!apply) {
+		return true;
+	}
 
-		if ((wada & RV8803_EXTENSION_MASK_WADA) == RV8803_WEEKDAY_ALARM) {
-			(*mask) |= RTC_ALARM_TIME_MASK_WEEKDAY;
-			timeptr->tm_wday = log2(regs[2] & RV8803_WEEKDAY_BITS);
-		} else {
-			(*mask) |= RTC_ALARM_TIME_MASK_MONTHDAY;
-			timeptr->tm_mday = bcd2bin(regs[2] & RV8803_DATE_BITS);
-		}
+	LOG_DBG("Discipline: [%d] ppb, OFFSET [0x%02X]", disc->ppb, offset);
+	caller = rv8803_bus_lock(rtc_config->base_dev, RV8803_BUS_CALLER_OTHER);
+	err = rv8803_bus_reg_write(rtc_config->base_dev, RV8803_REGISTER_OFFSET, offset);
+	rv8803_bus_unlock(rtc_config->base_dev, caller);
+	if (err < 0) {
+		LOG_ERR("Write OFFSET: [%d]", err);
+		rv8803_rtc_discipline_invalidate(dev);
 	}
 
-	return 0;
+	return true;
 }
 
-static int rv8803_rtc_alarm_is_pending(const struct device *dev, uint16_t id)
+int rv8803_rtc_discipline_start(const struct device *dev)
 {
-	ARG_UNUSED(id);
 	const struct rv8803_rtc_config *rtc_config = dev->config;
 	const struct rv8803_config *config = rtc_config->base_dev->config;
-	uint8_t reg;
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_discipline *disc = rtc_data->rtc_discipline;
+	enum rv8803_bus_caller caller;
+	k_spinlock_key_t key;
+	uint8_t offset;
 	int err;
 
-	err = i2c_reg_read_byte_dt(&config->i2c_bus, RV8803_REGISTER_FLAG, &reg);
+	if (config->gpio->irq_gpio.port == NULL) {
+		return -ENOTSUP;
+	}
+	if (disc->running) {
+		return -EALREADY;
+	}
+
+	caller = rv8803_bus_lock(rtc_config->base_dev, RV8803_BUS_CALLER_OTHER);
+	err = rv8803_bus_reg_read(rtc_config->base_dev, RV8803_REGISTER_OFFSET, &offset);
+	rv8803_bus_unlock(rtc_config->base_dev, caller);
 	if (err < 0) {
 		return err;
 	}
 
-	if (reg & RV8803_FLAG_MASK_ALARM) {
-		err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_FLAG,
-					     RV8803_FLAG_MASK_ALARM, RV8803_DISABLE_ALARM);
-		if (err < 0) {
-			return err;
-		}
-
-		return 1;
+	key = k_spin_lock(&disc->lock);
+	disc->ref_pending = false;
+	disc->pps_valid = false;
+	disc->last_valid = false;
+	disc->sum_w = 0;
+	disc->sum_wx = 0;
+	disc->sum_wxx = 0;
+	disc->samples = 0;
+	disc->ppb = 0;
+	disc->uncertainty_ppb = UINT32_MAX;
+	disc->offset = offset;
+	disc->calibration = rv8803_rtc_offset_to_calibration(offset);
+	disc->running = true;
+	k_spin_unlock(&disc->lock, key);
+
+	err = rv8803_rtc_update_refresh(dev);
+	if (err < 0) {
+		disc->running = false;
 	}
 
-	return 0;
+	return err;
 }
 
-static int rv8803_rtc_alarm_set_callback(const struct device *dev, uint16_t id,
-					 rtc_alarm_callback callback, void *user_data)
+int rv8803_rtc_discipline_stop(const struct device *dev)
 {
-	ARG_UNUSED(id);
-	const struct rv8803_rtc_config *rtc_config = dev->config;
-	const struct rv8803_config *config = rtc_config->base_dev->config;
-	if (config->gpio->irq_gpio.port == NULL) {
-		return -ENOTSUP;
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_discipline *disc = rtc_data->rtc_discipline;
+	k_spinlock_key_t key;
+
+	if (!disc->running) {
+		return -EALREADY;
 	}
 
-	struct rv8803_rtc_data *data = dev->data;
-	data->rtc_alarm->alarm_cb = callback;
-	data->rtc_alarm->alarm_cb_data = user_data;
+	key = k_spin_lock(&disc->lock);
+	disc->running = false;
+	disc->ref_pending = false;
+	k_spin_unlock(&disc->lock, key);
 
-	return 0;
+	/* The update interrupt stays on for the other consumers */
+	return rv8803_rtc_update_refresh(dev);
 }
-#endif /* CONFIG_RTC_ALARM */
-#endif
 
-#if RV8803_IRQ_GPIO_USE_UPDATE
-static int rv8803_setup_update_interrupt(const struct device *dev, bool disable)
+int rv8803_rtc_discipline_reference(const struct device *dev, int64_t ref_ns)
 {
-	const struct rv8803_rtc_config *rtc_config = dev->config;
-	const struct rv8803_config *config = rtc_config->base_dev->config;
-	int err;
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_discipline *disc = rtc_data->rtc_discipline;
 
-	/* UIE and UF to 0 : stop interrupt */
-	err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_CONTROL,
-				     RV8803_CONTROL_MASK_UPDATE, RV8803_DISABLE_UPDATE);
-	if (err < 0) {
-		return err;
-	}
-	err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_FLAG,
-				     RV8803_FLAG_MASK_UPDATE, RV8803_DISABLE_UPDATE);
-	if (err < 0) {
-		return err;
-	}
-
-	if (disable) {
-		return 0;
-	}
-
-	/* Choose USEL value */
-	err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_EXTENSION,
-				     RV8803_EXTENSION_MASK_UPDATE, RV8803_DISABLE_UPDATE);
-	if (err < 0) {
-		return err;
+	if (!disc->running) {
+		return -EPERM;
 	}
 
-	/* UIE to 1 : start interrupt */
-	err = i2c_reg_update_byte_dt(&config->i2c_bus, RV8803_REGISTER_CONTROL,
-				     RV8803_CONTROL_MASK_UPDATE, RV8803_ENABLE_UPDATE);
-	if (err < 0) {
-		return err;
-	}
+	rv8803_rtc_discipline_store(disc, false, ref_ns);
 
 	return 0;
 }
 
-static int rv8803_update_set_callback(const struct device *dev, rtc_update_callback callback,
-				      void *user_data)
+int rv8803_rtc_discipline_get(const struct device *dev,
+			      struct rv8803_rtc_discipline_status *status)
 {
-	const struct rv8803_rtc_config *rtc_config = dev->config;
-	const struct rv8803_config *config = rtc_config->base_dev->config;
-	if (config->gpio->irq_gpio.port == NULL) {
-		return -ENOTSUP;
-	}
-
-	struct rv8803_rtc_data *data = dev->data;
-	data->rtc_update->update_cb = callback;
-	data->rtc_update->update_cb_data = user_data;
+	const struct rv8803_rtc_data *rtc_data = dev->data;
+	struct rv8803_rtc_discipline *disc = rtc_data->rtc_discipline;
+	k_spinlock_key_t key;
 
-	if ((callback == NULL) && (user_data != NULL)) {
+	if (status == NULL) {
 		return -EINVAL;
 	}
-	int err = rv8803_setup_update_interrupt(dev, (callback == NULL) && (user_data == NULL));
-	if (err < 0) {
-		return err;
-	}
+
+	key = k_spin_lock(&disc->lock);
+	status->ppb = disc->ppb;
+	status->uncertainty_ppb = disc->uncertainty_ppb;
+	status->samples = disc->samples;
+	status->calibration = disc->calibration;
+	k_spin_unlock(&disc->lock, key);
 
 	return 0;
 }
-#endif /* CONFIG_RTC */
+#endif /* CONFIG_RV8803_RTC_DISCIPLINE */
 
 #if CONFIG_RTC && CONFIG_RV8803_RTC_ENABLE
 /* RV8803 RTC init */
@@ -491,27 +1647,97 @@ static int rv8803_rtc_init(const struct device *dev)
 		return -ENODEV;
 	}
 
+#if CONFIG_RV8803_RTC_SET_TIME_ALIGN
+	struct rv8803_rtc_align *align = ((struct rv8803_rtc_data *)dev->data)->rtc_align;
+
+	align->dev = dev;
+	k_work_init_delayable(&align->work, rv8803_rtc_align_work);
+#endif /* CONFIG_RV8803_RTC_SET_TIME_ALIGN */
+
 #if RV8803_IRQ_GPIO_IN_USE
-	struct rv8803_data *data = rtc_config->base_dev->data;
 	struct rv8803_rtc_data *rtc_data = dev->data;
+	uint8_t mask = 0;
 
 	rtc_data->rtc_irq->dev = dev;
-	data->irq->rtc_dev = dev;
-	data->irq->rtc_work.handler = rv8803_rtc_worker;
 
 #if RV8803_IRQ_GPIO_USE_ALARM
 	LOG_INF("RV8803 RTC ALARM INIT");
-	rtc_data->rtc_alarm->alarm_cb = NULL;
-	rtc_data->rtc_alarm->alarm_cb_data = NULL;
+	for (uint8_t i = 0; i < CONFIG_RV8803_RTC_ALARM_COUNT; i++) {
+		rtc_data->rtc_alarm->entries[i].alarm_cb = NULL;
+		rtc_data->rtc_alarm->entries[i].alarm_cb_data = NULL;
+		rtc_data->rtc_alarm->entries[i].next = -1;
+	}
+	mask |= RV8803_ALARM_FLAG_MASK;
 #endif /* RV8803_IRQ_GPIO_USE_ALARM */
 #if RV8803_IRQ_GPIO_USE_UPDATE
 	LOG_INF("RV8803 RTC UPDATE INIT");
 	rtc_data->rtc_update->update_cb = NULL;
 	rtc_data->rtc_update->update_cb_data = NULL;
+	rtc_data->rtc_update->period = rtc_config->update_period;
+#if CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS
+	k_mutex_init(&rtc_data->rtc_update->lock);
+	sys_slist_init(&rtc_data->rtc_update->subscribers);
+#endif /* CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS */
+	mask |= RV8803_FLAG_MASK_UPDATE;
 #endif /* RV8803_IRQ_GPIO_USE_UPDATE */
+#if RV8803_IRQ_GPIO_USE_EVI
+	LOG_INF("RV8803 RTC EVI INIT");
+	mask |= RV8803_FLAG_MASK_EVENT;
+#endif /* RV8803_IRQ_GPIO_USE_EVI */
+
+	rv8803_irq_register(rtc_config->base_dev, RV8803_IRQ_SLOT_RTC, mask,
+			    rv8803_rtc_irq_handler, dev);
 
 #endif /* RV8803_IRQ_GPIO_IN_USE */
 
+#if CONFIG_RTC_CALIBRATION
+	/* The OFFSET register survives on backup supply, restore it after a power loss only */
+	uint8_t offset;
+
+	if (rv8803_rtc_calibration_to_offset(rtc_config->calibration, &offset) < 0) {
+		LOG_ERR("Calibration out of range: [%d] ppb", rtc_config->calibration);
+		return -EINVAL;
+	}
+	if (rv8803_offset_restore(rtc_config->base_dev, offset) < 0) {
+		LOG_ERR("Failed to restore OFFSET register!!");
+	}
+#endif /* CONFIG_RTC_CALIBRATION */
+
+#if CONFIG_RV8803_RTC_DISCIPLINE
+	/* Reference pulse per second, optional: the application may push times instead */
+	const struct gpio_dt_spec *pps_gpio = &rtc_config->pps_gpio;
+	struct rv8803_rtc_data *data = dev->data;
+	int err;
+
+	data->rtc_discipline->uncertainty_ppb = UINT32_MAX;
+	if (pps_gpio->port != NULL) {
+		if (!gpio_is_ready_dt(pps_gpio)) {
+			LOG_ERR("PPS GPIO not ready!!");
+			return -ENODEV;
+		}
+
+		err = gpio_pin_configure_dt(pps_gpio, GPIO_INPUT);
+		if (err < 0) {
+			LOG_ERR("Failed to configure PPS GPIO!!");
+			return err;
+		}
+
+		err = gpio_pin_interrupt_configure_dt(pps_gpio, GPIO_INT_EDGE_TO_ACTIVE);
+		if (err < 0) {
+			LOG_ERR("Failed to configure PPS interrupt!!");
+			return err;
+		}
+
+		gpio_init_callback(&data->rtc_discipline->pps_cb,
+				   rv8803_rtc_discipline_pps_handler, BIT(pps_gpio->pin));
+		err = gpio_add_callback_dt(pps_gpio, &data->rtc_discipline->pps_cb);
+		if (err < 0) {
+			LOG_ERR("Failed to add PPS GPIO callback!!");
+			return err;
+		}
+	}
+#endif /* CONFIG_RV8803_RTC_DISCIPLINE */
+
 	LOG_INF("RV8803 RTC INIT");
 
 	return 0;
@@ -531,25 +1757,55 @@ static const struct rtc_driver_api rv8803_rtc_driver_api = {
 #if RV8803_IRQ_GPIO_USE_UPDATE
 	.update_set_callback = rv8803_update_set_callback,
 #endif
+#if CONFIG_RTC_CALIBRATION
+	.set_calibration = rv8803_rtc_set_calibration,
+	.get_calibration = rv8803_rtc_get_calibration,
+#endif /* CONFIG_RTC_CALIBRATION */
 };
 #endif
 
 #if CONFIG_RTC && CONFIG_RV8803_RTC_ENABLE
+/* EVENT_CONTROL without ECP: EHL from evi-edge, ET from evi-filter */
+#define RV8803_RTC_EVI_CONTROL(n)                                                                  \
+	((DT_INST_ENUM_IDX(n, evi_edge) ? RV8803_EVENT_CONTROL_RISING : 0) |                       \
+	 (DT_INST_ENUM_IDX(n, evi_filter) << RV8803_EVENT_CONTROL_FILTER_SHIFT))
+
 /* RV8803 RTC Initialization MACRO */
 #define RV8803_RTC_INIT(n)                                                                         \
 	static const struct rv8803_rtc_config rv8803_rtc_config_##n = {                            \
 		.base_dev = DEVICE_DT_GET(DT_PARENT(DT_INST(n, DT_DRV_COMPAT))),                   \
+		IF_ENABLED(RV8803_IRQ_GPIO_USE_UPDATE,                                             \
+			   (.update_period = DT_INST_ENUM_IDX(n, update_period), ))                \
+		IF_ENABLED(CONFIG_RTC_CALIBRATION,                                                 \
+			   (.calibration = DT_INST_PROP(n, calibration), ))                        \
+		IF_ENABLED(CONFIG_RV8803_RTC_DISCIPLINE,                                           \
+			   (.pps_gpio = GPIO_DT_SPEC_INST_GET_OR(n, pps_gpios, {0}), ))            \
+		IF_ENABLED(CONFIG_RV8803_RTC_EVI,                                                  \
+			   (.evi_control = RV8803_RTC_EVI_CONTROL(n), ))                           \
 	};                                                                                         \
 	IF_ENABLED(RV8803_IRQ_GPIO_IN_USE, (static struct rv8803_rtc_irq rv8803_rtc_irq_##n;))     \
 	IF_ENABLED(RV8803_IRQ_GPIO_USE_ALARM,                                                      \
 		   (static struct rv8803_rtc_alarm rv8803_rtc_alarm_##n;))                         \
 	IF_ENABLED(RV8803_IRQ_GPIO_USE_UPDATE,                                                     \
 		   (static struct rv8803_rtc_update rv8803_rtc_update_##n;))                       \
+	IF_ENABLED(CONFIG_RV8803_RTC_TIME_CACHE,                                                   \
+		   (static struct rv8803_rtc_anchor rv8803_rtc_anchor_##n;))                       \
+	IF_ENABLED(CONFIG_RV8803_RTC_SET_TIME_ALIGN,                                               \
+		   (static struct rv8803_rtc_align rv8803_rtc_align_##n;))                         \
+	IF_ENABLED(CONFIG_RV8803_RTC_DISCIPLINE,                                                   \
+		   (static struct rv8803_rtc_discipline rv8803_rtc_discipline_##n;))               \
+	IF_ENABLED(CONFIG_RV8803_RTC_EVI, (static struct rv8803_rtc_evi rv8803_rtc_evi_##n;))      \
 	static struct rv8803_rtc_data rv8803_rtc_data_##n = {                                      \
-		IF_ENABLED(RV8803_IRQ_GPIO_IN_USE, (.rtc_irq = &rv8803_rtc_irq_##n, )) IF_ENABLED( \
-			RV8803_IRQ_GPIO_USE_ALARM, (.rtc_alarm = &rv8803_rtc_alarm_##n, ))         \
-			IF_ENABLED(RV8803_IRQ_GPIO_USE_UPDATE,                                     \
-				   (.rtc_update = &rv8803_rtc_update_##n, ))};                     \
+		IF_ENABLED(RV8803_IRQ_GPIO_IN_USE, (.rtc_irq = &rv8803_rtc_irq_##n, ))             \
+		IF_ENABLED(RV8803_IRQ_GPIO_USE_ALARM, (.rtc_alarm = &rv8803_rtc_alarm_##n, ))      \
+		IF_ENABLED(RV8803_IRQ_GPIO_USE_UPDATE, (.rtc_update = &rv8803_rtc_update_##n, ))   \
+		IF_ENABLED(CONFIG_RV8803_RTC_TIME_CACHE, (.rtc_anchor = &rv8803_rtc_anchor_##n, )) \
+		IF_ENABLED(CONFIG_RV8803_RTC_SET_TIME_ALIGN,                                       \
+			   (.rtc_align = &rv8803_rtc_align_##n, ))                                 \
+		IF_ENABLED(CONFIG_RV8803_RTC_DISCIPLINE,                                           \
+			   (.rtc_discipline = &rv8803_rtc_discipline_##n, ))                       \
+		IF_ENABLED(CONFIG_RV8803_RTC_EVI, (.rtc_evi = &rv8803_rtc_evi_##n, ))              \
+	};                                                                                         \
 	DEVICE_DT_INST_DEFINE(n, rv8803_rtc_init, NULL, &rv8803_rtc_data_##n,                      \
 			      &rv8803_rtc_config_##n, POST_KERNEL, CONFIG_RTC_INIT_PRIORITY,       \
 			      &rv8803_rtc_driver_api);
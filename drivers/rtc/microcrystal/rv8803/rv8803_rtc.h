@@ -6,6 +6,14 @@
 #ifndef ZEPHYR_DRIVERS_RTC_RV8803_RTC_H_
 #define ZEPHYR_DRIVERS_RTC_RV8803_RTC_H_
 
+/* 100th of seconds, followed by a mirror of the calendar registers (0x11 - 0x17) */
+#define RV8803_REGISTER_HUNDREDTHS      0x10
+#define RV8803_REGISTER_CALENDAR_MIRROR 0x11
+#define RV8803_HUNDREDTHS_MS            10
+#define RV8803_CALENDAR_SIZE            7
+/* 100th of seconds and calendar mirror: 0x10 - 0x17 */
+#define RV8803_TIME_READ_SIZE           (1 + RV8803_CALENDAR_SIZE)
+
 /* Data masks */
 #define RV8803_SECONDS_BITS GENMASK(6, 0)
 #define RV8803_MINUTES_BITS GENMASK(6, 0)
@@ -33,12 +41,47 @@
 #define RV8803_FLAG_MASK_UPDATE      (0x01 << 5)
 #define RV8803_CONTROL_MASK_UPDATE   (0x01 << 5)
 
+/* Event input (EVI): time capture of seconds and 100th of seconds */
+#define RV8803_REGISTER_HUNDREDTHS_CP     0x20
+#define RV8803_REGISTER_SECONDS_CP        0x21
+#define RV8803_REGISTER_EVENT_CONTROL     0x2F
+#define RV8803_FLAG_MASK_EVENT            (0x01 << 2)
+#define RV8803_CONTROL_MASK_EVENT         (0x01 << 2)
+#define RV8803_ENABLE_EVENT               (0x01 << 2)
+#define RV8803_DISABLE_EVENT              (0x00 << 2)
+#define RV8803_EVENT_CONTROL_CAPTURE      (0x01 << 7) /* ECP */
+#define RV8803_EVENT_CONTROL_RISING       (0x01 << 6) /* EHL */
+#define RV8803_EVENT_CONTROL_FILTER_SHIFT 4           /* ET: none, 256 Hz, 64 Hz, 8 Hz sampling */
+
+/* Frequency offset: 6-bit two's complement, steps of 0.2384 ppm, positive is faster */
+#define RV8803_OFFSET_BITS          GENMASK(5, 0)
+#define RV8803_OFFSET_STEP_PPB_X10  2384
+#define RV8803_OFFSET_MIN           (-32)
+#define RV8803_OFFSET_MAX           31
+
+/* Drift estimator: samples needed before the servo acts, rates beyond which a sample is dropped */
+#define RV8803_RTC_DISCIPLINE_MIN_SAMPLES 4
+#define RV8803_RTC_DISCIPLINE_MAX_PPB     500000
+
+/* Virtual alarms: a day pattern repeats within two months */
+#define RV8803_ALARM_SEARCH_DAYS  62
+#define RV8803_SECONDS_PER_MINUTE 60
+#define RV8803_SECONDS_PER_HOUR   3600
+#define RV8803_SECONDS_PER_DAY    86400
+
+/* Second-resolution alarms count the last seconds down on the timer (TF, TIE) */
+#if CONFIG_RV8803_RTC_ALARM_SECONDS
+#define RV8803_ALARM_FLAG_MASK    (RV8803_FLAG_MASK_ALARM | RV8803_FLAG_MASK_COUNTER)
+#define RV8803_ALARM_CONTROL_MASK (RV8803_CONTROL_MASK_ALARM | RV8803_CONTROL_MASK_COUNTER)
+#else
+#define RV8803_ALARM_FLAG_MASK    RV8803_FLAG_MASK_ALARM
+#define RV8803_ALARM_CONTROL_MASK RV8803_CONTROL_MASK_ALARM
+#endif /* CONFIG_RV8803_RTC_ALARM_SECONDS */
+
 /* TM OFFSET */
 #define RV8803_TM_MONTH 1
 
 /* Control MACRO */
-/* Check for partial incrementation when reads get 59 seconds */
-#define RV8803_PARTIAL_SECONDS_INCR  59
 #define RV8803_CORRECT_YEAR_LEAP_MIN (2000 - 1900) /* Diff between 2000 and tm base year 1900 */
 #define RV8803_CORRECT_YEAR_LEAP_MAX (2099 - 1900) /* Diff between 2099 and tm base year 1900 */
 #define RV8803_RESET_BIT             (0x01 << 0)
@@ -53,10 +96,32 @@
 #define RV8803_DISABLE_UPDATE       (0x00 << 5)
 
 /* Structs */
+#if CONFIG_RV8803_RTC_EVI
+typedef void (*rv8803_rtc_evi_callback)(const struct device *dev, void *user_data);
+#endif /* CONFIG_RV8803_RTC_EVI */
+
 #if CONFIG_RTC && CONFIG_RV8803_RTC_ENABLE
 /* RV8803 RTC config */
+/* Update event period, the rtc_update callback is called once per period */
+enum rv8803_rtc_update_period {
+	RV8803_RTC_UPDATE_SECOND,
+	RV8803_RTC_UPDATE_MINUTE,
+};
+
 struct rv8803_rtc_config {
 	const struct device *base_dev; /* Parent device reference */
+#if RV8803_IRQ_GPIO_USE_UPDATE
+	enum rv8803_rtc_update_period update_period; /* Default */
+#endif /* RV8803_IRQ_GPIO_USE_UPDATE */
+#if CONFIG_RTC_CALIBRATION
+	int32_t calibration; /* Default written after a power loss (ppb) */
+#endif /* CONFIG_RTC_CALIBRATION */
+#if CONFIG_RV8803_RTC_DISCIPLINE
+	struct gpio_dt_spec pps_gpio; /* Optional reference pulse per second */
+#endif /* CONFIG_RV8803_RTC_DISCIPLINE */
+#if CONFIG_RV8803_RTC_EVI
+	uint8_t evi_control; /* EVENT_CONTROL edge and filter */
+#endif /* CONFIG_RV8803_RTC_EVI */
 };
 
 struct rv8803_rtc_irq {
@@ -65,26 +130,174 @@ struct rv8803_rtc_irq {
 #endif /* RV8803_IRQ_GPIO_IN_USE */
 };
 
-struct rv8803_rtc_alarm {
+struct rv8803_rtc_alarm_entry {
 #if RV8803_IRQ_GPIO_USE_ALARM
 	rtc_alarm_callback alarm_cb;
 	void *alarm_cb_data;
+	struct rtc_time time;
+	uint16_t mask;
+	int64_t next; /* Next occurrence in seconds since the epoch, -1 when disabled */
 #endif /* RV8803_IRQ_GPIO_USE_ALARM */
 };
 
+/* Virtual alarms, the nearest one is programmed in the alarm registers */
+struct rv8803_rtc_alarm {
+#if RV8803_IRQ_GPIO_USE_ALARM
+	struct rv8803_rtc_alarm_entry entries[CONFIG_RV8803_RTC_ALARM_COUNT];
+	uint8_t order[CONFIG_RV8803_RTC_ALARM_COUNT]; /* Enabled entries, nearest first */
+	uint8_t armed;                                /* Entries in order */
+	atomic_t pending;                             /* Bit per entry, latched on expiry */
+#endif /* RV8803_IRQ_GPIO_USE_ALARM */
+};
+
+#if CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS
+/* Update subscriber, owned by the caller: called on calendar seconds multiple of period */
+struct rv8803_rtc_update_subscriber {
+	sys_snode_t node;
+	rtc_update_callback callback;
+	void *user_data;
+	uint32_t period; /* Seconds, multiples of 60 allow the minute update event */
+};
+
+#define RV8803_RTC_UPDATE_SUBSCRIBER_DEFINE(_name, _callback, _user_data, _period)                 \
+	struct rv8803_rtc_update_subscriber _name = {                                              \
+		.callback = _callback,                                                             \
+		.user_data = _user_data,                                                           \
+		.period = _period,                                                                 \
+	}
+#endif /* CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS */
+
 struct rv8803_rtc_update {
 #if RV8803_IRQ_GPIO_USE_UPDATE
 	rtc_update_callback update_cb;
 	void *update_cb_data;
+	enum rv8803_rtc_update_period period;
+#if CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS
+	struct k_mutex lock; /* Subscriber list, held while the subscribers are called */
+	sys_slist_t subscribers;
+#endif /* CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS */
 #endif /* RV8803_IRQ_GPIO_USE_UPDATE */
 };
 
+/* Divider reset released from the work queue when the written second starts */
+struct rv8803_rtc_align {
+#if CONFIG_RV8803_RTC_SET_TIME_ALIGN
+	struct k_work_delayable work;
+	const struct device *dev;
+	uint8_t regs[RV8803_CALENDAR_SIZE]; /* Written second */
+	int64_t release;                    /* Kernel ticks at the start of the written second */
+	bool pending;
+#endif /* CONFIG_RV8803_RTC_SET_TIME_ALIGN */
+};
+
+/* Calendar second start in kernel ticks, get_time is extrapolated from it */
+struct rv8803_rtc_anchor {
+#if CONFIG_RV8803_RTC_TIME_CACHE
+	struct k_spinlock lock;
+	int64_t ticks;
+	int64_t second;    /* Seconds since the epoch */
+	int64_t served_ns; /* Last time served, keeps get_time monotonic */
+	bool valid;
+#endif /* CONFIG_RV8803_RTC_TIME_CACHE */
+};
+
+/* Phase of the RTC against a reference, sampled on the update interrupt edge */
+struct rv8803_rtc_discipline {
+#if CONFIG_RV8803_RTC_DISCIPLINE
+	struct k_spinlock lock;
+	struct gpio_callback pps_cb;
+	bool running;
+	/* Last reference edge, waiting for an update edge */
+	bool ref_pending;
+	bool ref_pps;
+	int64_t ref_ns; /* Reference time, unknown for a PPS edge */
+	int64_t ref_ticks;
+	uint32_t ref_cycles;
+	/* Numbering of the PPS edges */
+	bool pps_valid;
+	int64_t pps_ns;
+	int64_t pps_ticks;
+	/* Start of the sample interval */
+	bool last_valid;
+	int64_t last_ref_ns;
+	int64_t last_error_ns;
+	/* Interval rates without calibration, weighted by their length (s) */
+	int64_t sum_w;
+	int64_t sum_wx;
+	int64_t sum_wxx;
+	uint32_t samples;
+	int32_t ppb;
+	uint32_t uncertainty_ppb;
+	int32_t calibration; /* Written to OFFSET (ppb) */
+	uint8_t offset;
+#endif /* CONFIG_RV8803_RTC_DISCIPLINE */
+};
+
+/* EVI timestamps: the interrupt worker is the only producer, one consumer drains them */
+struct rv8803_rtc_evi {
+#if CONFIG_RV8803_RTC_EVI
+	struct rtc_time buf[CONFIG_RV8803_RTC_EVI_BUFFER_SIZE];
+	atomic_t head; /* Free running as uint32_t, written by the producer only */
+	atomic_t tail; /* Free running as uint32_t, written by the consumer only */
+	atomic_t dropped;
+	rv8803_rtc_evi_callback evi_cb;
+	void *evi_cb_data;
+	bool enabled;
+#endif /* CONFIG_RV8803_RTC_EVI */
+};
+
 /* RV8803 RTC data */
 struct rv8803_rtc_data {
 	struct rv8803_rtc_irq *rtc_irq;
 	struct rv8803_rtc_alarm *rtc_alarm;
 	struct rv8803_rtc_update *rtc_update;
+	struct rv8803_rtc_anchor *rtc_anchor;
+	struct rv8803_rtc_align *rtc_align;
+	struct rv8803_rtc_discipline *rtc_discipline;
+	struct rv8803_rtc_evi *rtc_evi;
 };
 #endif
 
+#if CONFIG_RV8803_RTC_DISCIPLINE
+struct rv8803_rtc_discipline_status {
+	int32_t ppb;              /* Oscillator error against the reference, positive is fast */
+	uint32_t uncertainty_ppb; /* Standard error of ppb, UINT32_MAX below two samples */
+	uint32_t samples;         /* Sample intervals measured since start */
+	int32_t calibration;      /* Correction in the OFFSET register (ppb) */
+};
+
+/* Enables the update interrupt, which stays on until stop when no update callback is set */
+int rv8803_rtc_discipline_start(const struct device *dev);
+int rv8803_rtc_discipline_stop(const struct device *dev);
+/* Reference time (ns since the epoch) valid at the call, for sources other than pps-gpios */
+int rv8803_rtc_discipline_reference(const struct device *dev, int64_t ref_ns);
+int rv8803_rtc_discipline_get(const struct device *dev,
+			      struct rv8803_rtc_discipline_status *status);
+#endif /* CONFIG_RV8803_RTC_DISCIPLINE */
+
+#if CONFIG_RV8803_RTC_EVI
+/* Captures with the devicetree edge and filter, callback is called from the interrupt worker */
+int rv8803_rtc_evi_enable(const struct device *dev, rv8803_rtc_evi_callback callback,
+			  void *user_data);
+int rv8803_rtc_evi_disable(const struct device *dev);
+/* Oldest timestamp with tm_nsec at 10 ms resolution, -EAGAIN when empty */
+int rv8803_rtc_evi_read(const struct device *dev, struct rtc_time *timeptr);
+/* Events lost while the buffer was full */
+uint32_t rv8803_rtc_evi_dropped(const struct device *dev);
+#endif /* CONFIG_RV8803_RTC_EVI */
+
+#if RV8803_IRQ_GPIO_USE_UPDATE
+/* Period of the rtc_update callback, switched without touching the alarm or the pending events */
+int rv8803_rtc_update_period_set(const struct device *dev, enum rv8803_rtc_update_period period);
+enum rv8803_rtc_update_period rv8803_rtc_update_period_get(const struct device *dev);
+#endif /* RV8803_IRQ_GPIO_USE_UPDATE */
+
+#if CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS
+/* Subscribers are called from the interrupt worker, after the rtc_update callback */
+int rv8803_rtc_update_subscribe(const struct device *dev,
+				struct rv8803_rtc_update_subscriber *subscriber);
+int rv8803_rtc_update_unsubscribe(const struct device *dev,
+				  struct rv8803_rtc_update_subscriber *subscriber);
+#endif /* CONFIG_RV8803_RTC_UPDATE_SUBSCRIBERS */
+
 #endif /* ZEPHYR_DRIVERS_RTC_RV8803_RTC_H_ */
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/rtc.h>
+#include <zephyr/drivers/counter.h>
+#include <zephyr/drivers/clock_control.h>
+
+#include "rv8803.h"
+#include "rv8803_clk.h"
+#include "rv8803_ram.h"
+#include "rv8803_emul.h"
+
+static const struct device *const rtc_dev = DEVICE_DT_GET(DT_ALIAS(rtc8803));
+static const struct device *const cnt_dev = DEVICE_DT_GET(DT_ALIAS(counter8803));
+static const struct device *const clk_dev = DEVICE_DT_GET(DT_ALIAS(clock8803));
+static const struct emul *const rv8803_emul = EMUL_DT_GET(DT_ALIAS(rv8803));
+
+static K_SEM_DEFINE(rv8803_bus_update_sem, 0, 1);
+
+/* I2C transactions of one call, within the bounds of the README "Bus usage" table */
+#define RV8803_TEST_TRANSFERS(call, ret, min, max)                                                 \
+	do {                                                                                       \
+		struct rv8803_emul_stats stats;                                                    \
+                                                                                                   \
+		rv8803_emul_stats_reset(rv8803_emul);                                              \
+		zassert_equal((call), (ret), "%s failed", #call);                                  \
+		rv8803_emul_stats_get(rv8803_emul, &stats);                                        \
+		zassert_between_inclusive(stats.transfers, (min), (max), "%s: %u transactions",    \
+					  #call, stats.transfers);                                 \
+	} while (0)
+
+static void rv8803_bus_update_cb(const struct device *dev, void *user_data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(user_data);
+
+	k_sem_give(&rv8803_bus_update_sem);
+}
+
+static void rv8803_bus_top_cb(const struct device *dev, void *user_data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(user_data);
+}
+
+ZTEST(rv8803_bus, test_rtc_time)
+{
+	struct rtc_time time = {
+		.tm_year = 124,
+		.tm_mon = 5,
+		.tm_mday = 1,
+		.tm_hour = 12,
+		.tm_wday = 6,
+	};
+
+	RV8803_TEST_TRANSFERS(rtc_set_time(rtc_dev, &time), 0, 1, 2);
+	RV8803_TEST_TRANSFERS(rtc_get_time(rtc_dev, &time), 0, 1, 2);
+}
+
+ZTEST(rv8803_bus, test_rtc_alarm)
+{
+	uint16_t mask = RTC_ALARM_TIME_MASK_MINUTE | RTC_ALARM_TIME_MASK_HOUR;
+	struct rtc_time time = {.tm_hour = 7, .tm_min = 30};
+
+	RV8803_TEST_TRANSFERS(rtc_alarm_set_time(rtc_dev, 0, mask, &time), 0, 2, 2);
+	RV8803_TEST_TRANSFERS(rtc_alarm_get_time(rtc_dev, 0, &mask, &time), 0, 0, 0);
+	RV8803_TEST_TRANSFERS(rtc_alarm_is_pending(rtc_dev, 0), 0, 0, 0);
+	RV8803_TEST_TRANSFERS(rtc_alarm_set_time(rtc_dev, 0, 0, NULL), 0, 2, 2);
+}
+
+ZTEST(rv8803_bus, test_rtc_update)
+{
+	struct rv8803_emul_stats stats;
+
+	RV8803_TEST_TRANSFERS(rtc_update_set_callback(rtc_dev, rv8803_bus_update_cb, NULL), 0, 1,
+			      1);
+	RV8803_TEST_TRANSFERS(rtc_update_set_callback(rtc_dev, rv8803_bus_update_cb, NULL), 0, 0,
+			      0);
+
+	/* One interrupt: a burst read, then a single FLAG write once the handlers ran */
+	k_sem_reset(&rv8803_bus_update_sem);
+	rv8803_emul_stats_reset(rv8803_emul);
+	zassert_ok(k_sem_take(&rv8803_bus_update_sem, K_MSEC(1500)));
+	k_sleep(K_MSEC(10));
+	rv8803_emul_stats_get(rv8803_emul, &stats);
+	zassert_equal(stats.transfers, 2, "Interrupt: %u transactions", stats.transfers);
+
+	RV8803_TEST_TRANSFERS(rtc_update_set_callback(rtc_dev, NULL, NULL), 0, 1, 1);
+}
+
+ZTEST(rv8803_bus, test_counter)
+{
+	struct counter_top_cfg cfg = {
+		.ticks = 10,
+		.callback = rv8803_bus_top_cb,
+	};
+
+	/* The software counter has its own suite */
+	Z_TEST_SKIP_IFDEF(CONFIG_RV8803_COUNTER_VIRTUAL);
+
+	RV8803_TEST_TRANSFERS(counter_set_top_value(cnt_dev, &cfg), 0, 1, 1);
+	cfg.ticks = 20;
+	cfg.flags = COUNTER_TOP_CFG_DONT_RESET;
+	RV8803_TEST_TRANSFERS(counter_set_top_value(cnt_dev, &cfg), 0, 0, 1);
+	RV8803_TEST_TRANSFERS(counter_get_top_value(cnt_dev), 20, 0, 0);
+	RV8803_TEST_TRANSFERS(counter_start(cnt_dev), 0, 0, 1);
+	RV8803_TEST_TRANSFERS(counter_get_pending_int(cnt_dev), 0, 0, 0);
+	RV8803_TEST_TRANSFERS(counter_stop(cnt_dev), 0, 0, 1);
+}
+
+ZTEST(rv8803_bus, test_clock)
+{
+	clock_control_subsys_rate_t rate;
+	uint32_t value;
+
+	rate = (clock_control_subsys_rate_t)RV8803_CLK_FREQUENCY_1024_HZ;
+
+	RV8803_TEST_TRANSFERS(clock_control_set_rate(clk_dev, NULL, rate), 0, 0, 1);
+	RV8803_TEST_TRANSFERS(clock_control_set_rate(clk_dev, NULL, rate), -EALREADY, 0, 0);
+	RV8803_TEST_TRANSFERS(clock_control_get_rate(clk_dev, NULL, &value), 0, 0, 0);
+	zassert_equal(value, RV8803_CLK_FREQUENCY_1024_HZ);
+
+	rate = (clock_control_subsys_rate_t)RV8803_CLK_FREQUENCY_32768_HZ;
+	zassert_ok(clock_control_set_rate(clk_dev, NULL, rate));
+}
+
+/* A failed write leaves the shadow copy as it was: the same update goes to the bus again */
+ZTEST(rv8803_bus, test_failed_transfer)
+{
+	clock_control_subsys_rate_t rate = (clock_control_subsys_rate_t)RV8803_CLK_FREQUENCY_1_HZ;
+	struct rtc_time time;
+
+	rv8803_emul_fail_next(rv8803_emul, -EIO);
+	RV8803_TEST_TRANSFERS(rtc_get_time(rtc_dev, &time), -EIO, 1, 1);
+	RV8803_TEST_TRANSFERS(rtc_get_time(rtc_dev, &time), 0, 1, 2);
+
+	rv8803_emul_fail_next(rv8803_emul, -EIO);
+	RV8803_TEST_TRANSFERS(clock_control_set_rate(clk_dev, NULL, rate), -EIO, 1, 1);
+	RV8803_TEST_TRANSFERS(clock_control_set_rate(clk_dev, NULL, rate), 0, 1, 1);
+
+	rate = (clock_control_subsys_rate_t)RV8803_CLK_FREQUENCY_32768_HZ;
+	zassert_ok(clock_control_set_rate(clk_dev, NULL, rate));
+}
+
+/* 0x11 - 0x1F mirror 0x00 - 0x0E, 0x18 is the RAM */
+ZTEST(rv8803_bus, test_mirror)
+{
+	rv8803_emul_reg_set(rv8803_emul, RV8803_REGISTER_RAM, 0x5A);
+	zassert_equal(rv8803_emul_reg_get(rv8803_emul, 0x18), 0x5A);
+	rv8803_emul_reg_set(rv8803_emul, 0x18, 0xA5);
+	zassert_equal(rv8803_emul_reg_get(rv8803_emul, RV8803_REGISTER_RAM), 0xA5);
+	zassert_equal(rv8803_emul_reg_get(rv8803_emul, 0x1F),
+		      rv8803_emul_reg_get(rv8803_emul, RV8803_REGISTER_FLAG));
+}
+
+static void *rv8803_bus_setup(void)
+{
+	zassert_true(device_is_ready(rtc_dev));
+	zassert_true(device_is_ready(cnt_dev));
+	zassert_true(device_is_ready(clk_dev));
+
+	return NULL;
+}
+
+ZTEST_SUITE(rv8803_bus, NULL, rv8803_bus_setup, NULL, NULL, NULL);
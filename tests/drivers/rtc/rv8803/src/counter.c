@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/counter.h>
+
+#include "rv8803.h"
+#include "rv8803_cnt.h"
+#include "rv8803_emul.h"
+
+#define RV8803_TEST_SHORT_TOP   10   /* Served by the timer itself */
+#define RV8803_TEST_CHAINED_TOP 6000 /* Chained from a 4095 ticks period and a shorter one */
+#define RV8803_TEST_MARGIN      2    /* Ticks: the first 1 Hz period follows the calendar */
+#define RV8803_TEST_ALARM_TOP   100
+#define RV8803_TEST_ALARM_TICKS 5
+#define RV8803_TEST_GUARD       10
+#define RV8803_TEST_TIMER_DELAY 5
+
+static const struct device *const cnt_dev = DEVICE_DT_GET(DT_ALIAS(counter8803));
+static const struct emul *const rv8803_emul = EMUL_DT_GET(DT_ALIAS(rv8803));
+
+static atomic_t rv8803_counter_wraps;
+static K_SEM_DEFINE(rv8803_counter_alarm_sem, 0, 1);
+static uint32_t rv8803_counter_alarm_ticks;
+#if CONFIG_RV8803_COUNTER_TIMERS
+static K_SEM_DEFINE(rv8803_counter_timer_sem, 0, 2);
+#endif /* CONFIG_RV8803_COUNTER_TIMERS */
+
+static void rv8803_counter_top_cb(const struct device *dev, void *user_data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(user_data);
+
+	atomic_inc(&rv8803_counter_wraps);
+}
+
+static void rv8803_counter_alarm_cb(const struct device *dev, uint8_t chan_id, uint32_t ticks,
+				    void *user_data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(chan_id);
+	ARG_UNUSED(user_data);
+
+	rv8803_counter_alarm_ticks = ticks;
+	k_sem_give(&rv8803_counter_alarm_sem);
+}
+
+#if CONFIG_RV8803_COUNTER_TIMERS
+static void rv8803_counter_timer_handler(struct rv8803_cnt_timer *timer, void *user_data)
+{
+	ARG_UNUSED(timer);
+	ARG_UNUSED(user_data);
+
+	k_sem_give(&rv8803_counter_timer_sem);
+}
+#endif /* CONFIG_RV8803_COUNTER_TIMERS */
+
+static uint16_t rv8803_counter_preset(void)
+{
+	return rv8803_emul_reg_get(rv8803_emul, RV8803_REGISTER_TIMER_COUNTER_0) |
+	       ((rv8803_emul_reg_get(rv8803_emul, RV8803_REGISTER_TIMER_COUNTER_1) & 0x0F) << 8);
+}
+
+/* Ticks of the counter frequency elapsed since start, in kernel time */
+static uint32_t rv8803_counter_elapsed(int64_t start)
+{
+	return (uint32_t)((k_uptime_get() - start) * counter_get_frequency(cnt_dev) /
+			  MSEC_PER_SEC);
+}
+
+static void rv8803_counter_value_check(uint32_t expected)
+{
+	uint32_t value;
+
+	zassert_ok(counter_get_value(cnt_dev, &value));
+	zassert_within(value, expected, RV8803_TEST_MARGIN, "Value %u, expected %u", value,
+		       expected);
+}
+
+/* A top within 12 bits is the timer period: it wraps on TF, no work item in between */
+ZTEST(rv8803_counter, test_short_top)
+{
+	struct counter_top_cfg cfg = {
+		.ticks = RV8803_TEST_SHORT_TOP,
+		.callback = rv8803_counter_top_cb,
+	};
+	int64_t start;
+
+	zassert_ok(counter_set_top_value(cnt_dev, &cfg));
+	zassert_ok(counter_start(cnt_dev));
+	start = k_uptime_get();
+	zassert_equal(rv8803_counter_preset(), RV8803_TEST_SHORT_TOP);
+
+	k_sleep(K_SECONDS(3 * RV8803_TEST_SHORT_TOP + RV8803_TEST_SHORT_TOP / 2));
+	zassert_equal(atomic_get(&rv8803_counter_wraps), 3);
+	rv8803_counter_value_check(rv8803_counter_elapsed(start) % RV8803_TEST_SHORT_TOP);
+}
+
+/* A top beyond 12 bits: the value goes on across the chained reload, then wraps once */
+ZTEST(rv8803_counter, test_chained_top)
+{
+	struct counter_top_cfg cfg = {
+		.ticks = RV8803_TEST_CHAINED_TOP,
+		.callback = rv8803_counter_top_cb,
+	};
+	uint64_t total;
+	int64_t start;
+
+	zassert_ok(counter_set_top_value(cnt_dev, &cfg));
+	zassert_ok(counter_start(cnt_dev));
+	start = k_uptime_get();
+
+	k_sleep(K_SECONDS(RV8803_COUNTER_MAX_TOP_VALUE + 100));
+	zassert_equal(atomic_get(&rv8803_counter_wraps), 0);
+	rv8803_counter_value_check(rv8803_counter_elapsed(start));
+
+	k_sleep(K_SECONDS(RV8803_TEST_CHAINED_TOP - RV8803_COUNTER_MAX_TOP_VALUE));
+	zassert_equal(atomic_get(&rv8803_counter_wraps), 1);
+	rv8803_counter_value_check(rv8803_counter_elapsed(start) - RV8803_TEST_CHAINED_TOP);
+
+	zassert_ok(counter_get_value_64(cnt_dev, &total));
+	zassert_within(total, rv8803_counter_elapsed(start), RV8803_TEST_MARGIN);
+}
+
+/* A few ticks away, the alarm is the timer period: it expires on TF */
+ZTEST(rv8803_counter, test_alarm_relative)
+{
+	struct counter_alarm_cfg alarm = {
+		.ticks = RV8803_TEST_ALARM_TICKS,
+		.callback = rv8803_counter_alarm_cb,
+	};
+	uint32_t value;
+
+	zassert_ok(counter_start(cnt_dev));
+	zassert_ok(counter_get_value(cnt_dev, &value));
+	zassert_ok(counter_set_channel_alarm(cnt_dev, 0, &alarm));
+	zassert_equal(rv8803_counter_preset(), RV8803_TEST_ALARM_TICKS);
+
+	zassert_ok(k_sem_take(&rv8803_counter_alarm_sem,
+			      K_SECONDS(RV8803_TEST_ALARM_TICKS + RV8803_TEST_MARGIN)));
+	zassert_within(rv8803_counter_alarm_ticks, value + RV8803_TEST_ALARM_TICKS,
+		       RV8803_TEST_MARGIN);
+}
+
+ZTEST(rv8803_counter, test_alarm_absolute)
+{
+	struct counter_top_cfg cfg = {
+		.ticks = RV8803_TEST_ALARM_TOP,
+	};
+	struct counter_alarm_cfg alarm = {
+		.callback = rv8803_counter_alarm_cb,
+		.flags = COUNTER_ALARM_CFG_ABSOLUTE,
+	};
+	uint32_t value;
+
+	zassert_ok(counter_set_top_value(cnt_dev, &cfg));
+	zassert_ok(counter_start(cnt_dev));
+	k_sleep(K_SECONDS(RV8803_TEST_ALARM_TICKS));
+
+	zassert_ok(counter_get_value(cnt_dev, &value));
+	alarm.ticks = value + RV8803_TEST_ALARM_TICKS;
+	zassert_ok(counter_set_channel_alarm(cnt_dev, 0, &alarm));
+	zassert_equal(rv8803_counter_preset(), RV8803_TEST_ALARM_TICKS);
+
+	zassert_ok(k_sem_take(&rv8803_counter_alarm_sem,
+			      K_SECONDS(RV8803_TEST_ALARM_TICKS + RV8803_TEST_MARGIN)));
+	zassert_within(rv8803_counter_alarm_ticks, alarm.ticks, RV8803_TEST_MARGIN);
+}
+
+/* Behind the value within the guard period: -ETIME, called at once only when asked */
+ZTEST(rv8803_counter, test_alarm_late)
+{
+	struct counter_top_cfg cfg = {
+		.ticks = RV8803_TEST_ALARM_TOP,
+	};
+	struct counter_alarm_cfg alarm = {
+		.callback = rv8803_counter_alarm_cb,
+		.flags = COUNTER_ALARM_CFG_ABSOLUTE,
+	};
+	uint32_t value;
+
+	zassert_ok(counter_set_top_value(cnt_dev, &cfg));
+	zassert_ok(counter_set_guard_period(cnt_dev, RV8803_TEST_GUARD,
+					    COUNTER_GUARD_PERIOD_LATE_TO_SET));
+	zassert_ok(counter_start(cnt_dev));
+	k_sleep(K_SECONDS(RV8803_TEST_GUARD));
+
+	zassert_ok(counter_get_value(cnt_dev, &value));
+	alarm.ticks = value - 1;
+	zassert_equal(counter_set_channel_alarm(cnt_dev, 0, &alarm), -ETIME);
+	zassert_equal(k_sem_take(&rv8803_counter_alarm_sem, K_NO_WAIT), -EBUSY);
+
+	alarm.flags |= COUNTER_ALARM_CFG_EXPIRE_WHEN_LATE;
+	zassert_equal(counter_set_channel_alarm(cnt_dev, 0, &alarm), -ETIME);
+	zassert_ok(k_sem_take(&rv8803_counter_alarm_sem, K_NO_WAIT));
+	zassert_within(rv8803_counter_alarm_ticks, value, 1);
+}
+
+#if CONFIG_RV8803_COUNTER_TIMERS
+/* The second timer is due within the slack window of the first one: a single wake-up */
+ZTEST(rv8803_counter, test_timer_slack)
+{
+	RV8803_CNT_TIMER_DEFINE(first, rv8803_counter_timer_handler, NULL);
+	RV8803_CNT_TIMER_DEFINE(second, rv8803_counter_timer_handler, NULL);
+	struct rv8803_emul_stats stats;
+
+	zassert_ok(counter_start(cnt_dev));
+	rv8803_emul_stats_reset(rv8803_emul);
+	zassert_ok(rv8803_cnt_timer_start(cnt_dev, &first, RV8803_TEST_TIMER_DELAY, 0));
+	zassert_ok(rv8803_cnt_timer_start(cnt_dev, &second, RV8803_TEST_TIMER_DELAY + 1, 0));
+
+	zassert_ok(k_sem_take(&rv8803_counter_timer_sem,
+			      K_SECONDS(RV8803_TEST_TIMER_DELAY + RV8803_TEST_MARGIN)));
+	zassert_ok(k_sem_take(&rv8803_counter_timer_sem, K_NO_WAIT), "Second timer not batched");
+
+	/* Past the expiry of the second timer */
+	k_sleep(K_SECONDS(RV8803_TEST_MARGIN));
+	rv8803_emul_stats_get(rv8803_emul, &stats);
+	zassert_equal(stats.timer_events, 1, "%u TF events", stats.timer_events);
+}
+#endif /* CONFIG_RV8803_COUNTER_TIMERS */
+
+static void *rv8803_counter_setup(void)
+{
+	zassert_true(device_is_ready(cnt_dev));
+
+	return NULL;
+}
+
+static void rv8803_counter_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	atomic_clear(&rv8803_counter_wraps);
+	k_sem_reset(&rv8803_counter_alarm_sem);
+}
+
+static void rv8803_counter_after(void *fixture)
+{
+	struct counter_top_cfg cfg = {
+		.ticks = RV8803_COUNTER_TOP_VALUE_LIMIT,
+	};
+
+	ARG_UNUSED(fixture);
+
+	zassert_ok(counter_cancel_channel_alarm(cnt_dev, 0));
+	zassert_ok(counter_stop(cnt_dev));
+	zassert_ok(counter_set_top_value(cnt_dev, &cfg));
+	zassert_ok(counter_set_guard_period(cnt_dev, 0, COUNTER_GUARD_PERIOD_LATE_TO_SET));
+}
+
+ZTEST_SUITE(rv8803_counter, NULL, rv8803_counter_setup, rv8803_counter_before,
+	    rv8803_counter_after, NULL);
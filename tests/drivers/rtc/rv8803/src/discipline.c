@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/rtc.h>
+
+#include "rv8803.h"
+#include "rv8803_rtc.h"
+#include "rv8803_emul.h"
+
+#define RV8803_TEST_DRIFT_PPB     2000
+#define RV8803_TEST_HALF_STEP_PPB 119 /* Half an OFFSET step */
+#define RV8803_TEST_SAMPLES       6   /* Two more than needed before OFFSET is written */
+#define RV8803_TEST_INTERVALS     32
+
+static const struct device *const rtc_dev = DEVICE_DT_GET(DT_ALIAS(rtc8803));
+static const struct emul *const rv8803_emul = EMUL_DT_GET(DT_ALIAS(rv8803));
+static const struct gpio_dt_spec pps = GPIO_DT_SPEC_GET(DT_ALIAS(rtc8803), pps_gpios);
+
+/* Oscillator fast by 2000 ppb against an ideal PPS: OFFSET lands on the opposite step */
+ZTEST(rv8803_discipline, test_convergence)
+{
+	struct rv8803_rtc_discipline_status status = {0};
+	uint32_t bound;
+
+	rv8803_emul_drift_set(rv8803_emul, RV8803_TEST_DRIFT_PPB);
+	rv8803_emul_pps_set(rv8803_emul, &pps);
+	zassert_ok(rv8803_rtc_discipline_start(rtc_dev));
+
+	for (int i = 0; i < RV8803_TEST_INTERVALS; i++) {
+		k_sleep(K_SECONDS(CONFIG_RV8803_RTC_DISCIPLINE_INTERVAL));
+		zassert_ok(rv8803_rtc_discipline_get(rtc_dev, &status));
+		if ((status.samples >= RV8803_TEST_SAMPLES) && (status.calibration != 0)) {
+			break;
+		}
+	}
+
+	zassert_true(status.samples >= RV8803_TEST_SAMPLES, "%u samples", status.samples);
+	zassert_true(status.uncertainty_ppb < RV8803_TEST_HALF_STEP_PPB, "+/- %u ppb",
+		     status.uncertainty_ppb);
+
+	/* Within half a step of OFFSET and three standard errors of the estimate */
+	bound = RV8803_TEST_HALF_STEP_PPB + 3 * status.uncertainty_ppb;
+	zassert_true(abs(status.ppb - RV8803_TEST_DRIFT_PPB) <= bound, "Estimate %d ppb",
+		     status.ppb);
+	zassert_true(abs(status.calibration + RV8803_TEST_DRIFT_PPB) <= bound,
+		     "Calibration %d ppb", status.calibration);
+}
+
+static void *rv8803_discipline_setup(void)
+{
+	zassert_true(device_is_ready(rtc_dev));
+	zassert_true(gpio_is_ready_dt(&pps));
+
+	return NULL;
+}
+
+static void rv8803_discipline_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	rv8803_rtc_discipline_stop(rtc_dev);
+	rv8803_emul_pps_set(rv8803_emul, NULL);
+	rv8803_emul_drift_set(rv8803_emul, 0);
+	zassert_ok(rtc_set_calibration(rtc_dev, 0));
+}
+
+ZTEST_SUITE(rv8803_discipline, NULL, rv8803_discipline_setup, NULL, rv8803_discipline_after,
+	    NULL);
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <time.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/rtc.h>
+#include <zephyr/sys/timeutil.h>
+
+#include "rv8803.h"
+#include "rv8803_rtc.h"
+#include "rv8803_emul.h"
+
+#define RV8803_TEST_BYTE_TIME_NS 100000 /* An 8 bytes time burst lasts 0.8 ms */
+#define RV8803_TEST_READS        50
+#define RV8803_TEST_READ_GAP_US  1000
+
+static const struct device *const rtc_dev = DEVICE_DT_GET(DT_ALIAS(rtc8803));
+static const struct emul *const rv8803_emul = EMUL_DT_GET(DT_ALIAS(rv8803));
+
+/* Last second before each calendar field rolls over */
+static const struct {
+	const char *name;
+	struct tm time;
+} rv8803_test_boundaries[] = {
+	{"second", {.tm_year = 124, .tm_mon = 2, .tm_mday = 14, .tm_hour = 12, .tm_sec = 30}},
+	{"minute", {.tm_year = 124, .tm_mon = 2, .tm_mday = 14, .tm_hour = 12, .tm_sec = 59}},
+	{"hour", {.tm_year = 124, .tm_mon = 2, .tm_mday = 14, .tm_hour = 12, .tm_min = 59,
+		  .tm_sec = 59}},
+	{"day", {.tm_year = 124, .tm_mon = 2, .tm_mday = 14, .tm_hour = 23, .tm_min = 59,
+		 .tm_sec = 59}},
+	{"month", {.tm_year = 124, .tm_mon = 1, .tm_mday = 29, .tm_hour = 23, .tm_min = 59,
+		   .tm_sec = 59}},
+	{"year", {.tm_year = 123, .tm_mon = 11, .tm_mday = 31, .tm_hour = 23, .tm_min = 59,
+		  .tm_sec = 59}},
+};
+
+/* Reads across the increment following start: whole calendars, never going back */
+static void rv8803_test_cross(const char *name, const struct tm *start)
+{
+	time_t before = timeutil_timegm64(start);
+	struct rtc_time time;
+	int64_t last_ns = -1;
+	bool crossed = false;
+
+	gmtime_r(&before, rtc_time_to_tm(&time));
+	time.tm_nsec = 0;
+	zassert_ok(rtc_set_time(rtc_dev, &time), "%s: set time", name);
+
+	/* The increment comes within 10 ms */
+	rv8803_emul_reg_set(rv8803_emul, RV8803_REGISTER_HUNDREDTHS, 0x99);
+
+	for (int i = 0; i < RV8803_TEST_READS; i++) {
+		int64_t second;
+		int64_t ns;
+
+		zassert_ok(rtc_get_time(rtc_dev, &time), "%s: get time", name);
+		second = timeutil_timegm64(rtc_time_to_tm(&time));
+		zassert_true((second == before) || (second == (before + 1)),
+			     "%s: torn calendar %04d-%02d-%02d %02d:%02d:%02d", name,
+			     time.tm_year + 1900, time.tm_mon + 1, time.tm_mday, time.tm_hour,
+			     time.tm_min, time.tm_sec);
+
+		ns = (second - before) * NSEC_PER_SEC + time.tm_nsec;
+		zassert_true(ns >= last_ns, "%s: time went back by %lld ns", name,
+			     (long long)(last_ns - ns));
+		last_ns = ns;
+		crossed = crossed || (second != before);
+
+		k_busy_wait(RV8803_TEST_READ_GAP_US);
+	}
+
+	zassert_true(crossed, "%s: the calendar did not roll over", name);
+}
+
+ZTEST(rv8803_time, test_boundary_reads)
+{
+	for (int i = 0; i < ARRAY_SIZE(rv8803_test_boundaries); i++) {
+		rv8803_test_cross(rv8803_test_boundaries[i].name, &rv8803_test_boundaries[i].time);
+	}
+}
+
+static void *rv8803_time_setup(void)
+{
+	zassert_true(device_is_ready(rtc_dev));
+
+	return NULL;
+}
+
+static void rv8803_time_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* The clock ticks while the burst is clocked out */
+	rv8803_emul_byte_time_set(rv8803_emul, RV8803_TEST_BYTE_TIME_NS);
+}
+
+static void rv8803_time_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	rv8803_emul_byte_time_set(rv8803_emul, 0);
+}
+
+ZTEST_SUITE(rv8803_time, NULL, rv8803_time_setup, rv8803_time_before, rv8803_time_after, NULL);